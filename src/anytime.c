@@ -0,0 +1,125 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "include.h"
+#include "anytime.h"
+#include "heuristic.h"
+#include "local_search.h"
+#include "rng.h"
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+/* the seconds left before the deadline */
+static double remaining(boost::posix_time::ptime end){
+	return (end - boost::posix_time::microsec_clock::universal_time()).total_microseconds() / 1e6;
+}
+
+/* a copy of the tree becomes the best one if it has fewer branch vertices,
+   returns 1 when the lower bound is reached */
+static int publish(Pbudget_result result, Pspanning_tree tree, boost::posix_time::ptime start){
+	int optimal;
+
+	result->lock.lock();
+	result->trees++;
+	if (result->tree == NULL || tree->branch_vertices_number < result->branch_vertices){
+		if (result->tree != NULL){
+			free_spanning_tree(result->tree);
+		}
+		result->tree = copy_spanning_tree(tree);
+		result->branch_vertices = tree->branch_vertices_number;
+		result->time = (boost::posix_time::microsec_clock::universal_time() - start).total_microseconds() / 1e6;
+	}
+	optimal = result->branch_vertices <= result->lower_bound;
+	result->lock.unlock();
+
+	return optimal;
+}
+
+void init_budget_result(Pbudget_result result, unsigned long long seed){
+	result->tree = NULL;
+	result->branch_vertices = -1;
+	result->lower_bound = 0;
+	result->trees = 0;
+	result->time = 0;
+	result->seed = seed;
+}
+
+Pspanning_tree budget_result_best(Pbudget_result result, int *branch_vertices){
+	Pspanning_tree tree = NULL;
+
+	result->lock.lock();
+	if (result->tree != NULL){
+		tree = copy_spanning_tree(result->tree);
+	}
+	if (branch_vertices != NULL){
+		*branch_vertices = result->branch_vertices;
+	}
+	result->lock.unlock();
+
+	return tree;
+}
+
+int MBVST_with_budget(Pgraph g, double deadline, Pbudget_result result){
+	boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+	boost::posix_time::ptime end = start + boost::posix_time::microseconds((long long)(deadline*1e6));
+	Pmbvst_workspace w;
+	Pspanning_tree tree;
+	int k,finished,optimal;
+	rng r;
+
+	result->lock.lock();
+	result->lower_bound = get_branch_vertex_lower_bound(g);
+	result->lock.unlock();
+
+	/* a first tree at once */
+	tree = MBVST_fast(g);
+	if (remaining(end) > 0){
+		local_search(g,tree,remaining(end));
+	}
+	optimal = publish(result,tree,start);
+	free_spanning_tree(tree);
+
+	/* run 0 is MBVST, the others break the ties at random */
+	for (k = 0; !optimal && remaining(end) > 0; k++){
+		w = new_mbvst_workspace(g);
+		if (k > 0){
+			init_rng(&r,result->seed,k);
+			w->r = &r;
+		}
+
+		finished = 1;
+		while (mbvst_step(w)){
+			if (remaining(end) <= 0){
+				finished = 0;
+				break;
+			}
+		}
+
+		if (finished){
+			if (remaining(end) > 0){
+				local_search(g,w->tree,remaining(end));
+			}
+			optimal = publish(result,w->tree,start);
+		}
+		free_mbvst_workspace(w);
+	}
+
+	return result->branch_vertices;
+}
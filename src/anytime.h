@@ -0,0 +1,88 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+/** @file anytime.h
+ *
+ * @brief This file manages the MBVST heuristic under a time budget.
+ *
+ * A cover tree is found at once (MBVST_fast and the local search), then
+ * improved until the deadline : MBVST itself, one step of the minimum cut at
+ * a time, then MBVST with random tie-breaking, every tree being improved by
+ * the local search. The best tree so far is kept in a result that other
+ * threads may read at any moment.
+ */
+
+#ifndef ANYTIME__H
+#define ANYTIME__H
+
+#include "include.h"
+#include "spanning_tree.h"
+
+#include <boost/thread/mutex.hpp>
+
+/**
+ * \struct budget_result
+ * \brief best tree of MBVST_with_budget
+ *
+ * \a tree is the best tree so far (NULL before the first one) with its
+ *  branch_vertices (-1 before), time is the number of seconds it took to be
+ *  found and trees the number of trees found. The optimal number of branch
+ *  vertices is at least lower_bound. The fields are written under lock.
+ */
+typedef struct budget_result {
+	Pspanning_tree tree;
+	int branch_vertices;
+	int lower_bound;
+	int trees;
+	double time;
+	unsigned long long seed;
+	boost::mutex lock;
+} budget_result, *Pbudget_result;
+
+/**
+ * This function initializes an empty result.
+ * @param result The result.
+ * @param seed   The seed of the random tie-breaking.
+ */
+void init_budget_result(Pbudget_result result, unsigned long long seed);
+
+/**
+ * This function returns a copy of the best tree so far, it can be called
+ * while MBVST_with_budget runs in another thread.
+ * @param  result           The result.
+ * @param  branch_vertices  If not NULL, filled with the number of branch
+ *                          vertices of the tree.
+ * @return                  The copy, NULL if there is no tree yet.
+ */
+Pspanning_tree budget_result_best(Pbudget_result result, int *branch_vertices);
+
+/**
+ * This function applies the MBVST heuristic to graph G within a time
+ * budget. A first tree is always found, even if the budget is already
+ * spent, then it is improved until the deadline or until it reaches the
+ * lower bound. The caller frees result->tree.
+ * @param  g        The graph G.
+ * @param  deadline The budget in seconds from the call.
+ * @param  result   The result, initialized by init_budget_result.
+ * @return          The number of branch vertices of the best tree.
+ */
+int MBVST_with_budget(Pgraph g, double deadline, Pbudget_result result);
+
+#endif
@@ -0,0 +1,45 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "include.h"
+#include "bgl_graph.h"
+
+Pbgl_graph new_bgl_graph(int size1, int **edges_list, int size2, int *weight_list){
+	Pbgl_graph g = (bgl_graph*) malloc(sizeof(bgl_graph));
+
+	if (g == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	g->vertices_number = size1;
+	g->edges_number = size2;
+	g->edges_list = edges_list;
+	g->weight_list = weight_list;
+	g->incidence = new_incidence(edges_list,size1,size2);
+
+	return g;
+}
+
+Pbgl_graph free_bgl_graph(Pbgl_graph g){
+	free_incidence(g->incidence);
+	free(g);
+
+	return NULL;
+}
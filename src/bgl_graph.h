@@ -0,0 +1,222 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+/** @file bgl_graph.h
+ *
+ * @brief This file exposes an edge list to the Boost Graph Library.
+ *
+ * A bgl_graph is a view over an edge list and its weight list : only the
+ * incidence index (the edge ids around every vertex) is built, the edges and
+ * the weights are read in place. It models the IncidenceGraph and
+ * VertexListGraph concepts, the weights are its edge_weight property map and
+ * the vertices are their own index, so BGL algorithms such as
+ * stoer_wagner_min_cut run on it without any intermediate adjacency_list.
+ */
+
+#ifndef BGL__GRAPH__H
+#define BGL__GRAPH__H
+
+#include "include.h"
+#include "incidence.h"
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/property_map/property_map.hpp>
+
+/**
+ * \struct bgl_graph
+ * \brief BGL view structure
+ *
+ * \a The edges of the view are the edges_list, their weights the
+ *  weight_list, and incidence holds the incident edges of every vertex.
+ */
+typedef struct bgl_graph {
+	int vertices_number;
+	int edges_number;
+	int **edges_list;
+	int *weight_list;
+	Pincidence incidence;
+} bgl_graph, *Pbgl_graph;
+
+/**
+ * \struct bgl_edge
+ * \brief BGL edge descriptor
+ *
+ * \a An edge seen from its source : its id in edges_list and its two ends.
+ */
+typedef struct bgl_edge {
+	int id;
+	int source;
+	int target;
+
+	bool operator==(const bgl_edge &e) const { return id == e.id && source == e.source; }
+	bool operator!=(const bgl_edge &e) const { return !(*this == e); }
+} bgl_edge;
+
+/**
+ * This function creates a BGL view over an edge list. The edges list and the
+ * weight list are not copied and must outlive the view.
+ * @param  size1       The number of vertices.
+ * @param  edges_list  The list of the edges.
+ * @param  size2       The size of edges_list.
+ * @param  weight_list The weight of all edges.
+ * @return             The view.
+ */
+Pbgl_graph new_bgl_graph(int size1, int **edges_list, int size2, int *weight_list);
+
+/**
+ * This function frees a BGL view, not the lists it reads.
+ * @param  g The view.
+ * @return   A null pointer.
+ */
+Pbgl_graph free_bgl_graph(Pbgl_graph g);
+
+/**
+ * \class bgl_out_edge_iterator
+ * \brief iterator over the incident edges of a vertex
+ */
+class bgl_out_edge_iterator : public boost::iterator_facade<bgl_out_edge_iterator, bgl_edge, std::random_access_iterator_tag, bgl_edge> {
+public:
+	bgl_out_edge_iterator() : g(NULL), v(0), k(0) {}
+	bgl_out_edge_iterator(const bgl_graph *g, int v, int k) : g(g), v(v), k(k) {}
+
+private:
+	friend class boost::iterator_core_access;
+
+	bgl_edge dereference() const {
+		bgl_edge e;
+		e.id = g->incidence->edges[k];
+		e.source = v;
+		e.target = incidence_other_end(g->edges_list,e.id,v);
+		return e;
+	}
+	bool equal(const bgl_out_edge_iterator &i) const { return k == i.k; }
+	void increment() { k++; }
+	void decrement() { k--; }
+	void advance(std::ptrdiff_t n) { k += n; }
+	std::ptrdiff_t distance_to(const bgl_out_edge_iterator &i) const { return i.k - k; }
+
+	const bgl_graph *g;
+	int v;
+	int k;
+};
+
+/**
+ * \struct bgl_weight_map
+ * \brief edge_weight property map reading the weight list
+ */
+typedef struct bgl_weight_map {
+	typedef bgl_edge key_type;
+	typedef int value_type;
+	typedef int reference;
+	typedef boost::readable_property_map_tag category;
+
+	const int *weight_list;
+} bgl_weight_map;
+
+namespace boost {
+
+	struct bgl_graph_traversal_tag : public incidence_graph_tag, public vertex_list_graph_tag {};
+
+	template <> struct graph_traits<bgl_graph> {
+		typedef int vertex_descriptor;
+		typedef bgl_edge edge_descriptor;
+		typedef undirected_tag directed_category;
+		typedef allow_parallel_edge_tag edge_parallel_category;
+		typedef bgl_graph_traversal_tag traversal_category;
+
+		typedef bgl_out_edge_iterator out_edge_iterator;
+		typedef counting_iterator<int> vertex_iterator;
+		typedef void adjacency_iterator;
+		typedef void in_edge_iterator;
+		typedef void edge_iterator;
+
+		typedef int vertices_size_type;
+		typedef int edges_size_type;
+		typedef int degree_size_type;
+
+		static vertex_descriptor null_vertex() { return -1; }
+	};
+
+	template <> struct property_map<bgl_graph, edge_weight_t> {
+		typedef bgl_weight_map type;
+		typedef bgl_weight_map const_type;
+	};
+
+	template <> struct property_map<bgl_graph, vertex_index_t> {
+		typedef typed_identity_property_map<int> type;
+		typedef typed_identity_property_map<int> const_type;
+	};
+
+}
+
+/* the functions are found by ADL and, for the calls qualified by boost::,
+ * through the using-declarations below */
+inline int get(const bgl_weight_map &m, const bgl_edge &e){
+	return m.weight_list[e.id];
+}
+
+inline int source(const bgl_edge &e, const bgl_graph &){
+	return e.source;
+}
+
+inline int target(const bgl_edge &e, const bgl_graph &){
+	return e.target;
+}
+
+inline std::pair<bgl_out_edge_iterator, bgl_out_edge_iterator> out_edges(int v, const bgl_graph &g){
+	return std::make_pair(bgl_out_edge_iterator(&g,v,g.incidence->start[v]), bgl_out_edge_iterator(&g,v,g.incidence->start[v+1]));
+}
+
+inline int out_degree(int v, const bgl_graph &g){
+	return g.incidence->start[v+1] - g.incidence->start[v];
+}
+
+inline std::pair<boost::counting_iterator<int>, boost::counting_iterator<int> > vertices(const bgl_graph &g){
+	return std::make_pair(boost::counting_iterator<int>(0), boost::counting_iterator<int>(g.vertices_number));
+}
+
+inline int num_vertices(const bgl_graph &g){
+	return g.vertices_number;
+}
+
+inline bgl_weight_map get(boost::edge_weight_t, const bgl_graph &g){
+	bgl_weight_map m;
+	m.weight_list = g.weight_list;
+	return m;
+}
+
+inline boost::typed_identity_property_map<int> get(boost::vertex_index_t, const bgl_graph &){
+	return boost::typed_identity_property_map<int>();
+}
+
+namespace boost {
+
+	using ::source;
+	using ::target;
+	using ::out_edges;
+	using ::out_degree;
+	using ::vertices;
+	using ::num_vertices;
+
+}
+
+#endif
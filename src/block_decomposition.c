@@ -0,0 +1,339 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "include.h"
+#include "block_decomposition.h"
+#include "tools.h"
+#include "constructive.h"
+
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/bind/bind.hpp>
+
+/**
+ * \struct int_array
+ * \brief growing array of integers
+ */
+typedef struct int_array {
+	int *values;
+	int size;
+	int capacity;
+} int_array;
+
+/**
+ * \struct block_batch
+ * \brief work shared by the threads of solve_by_blocks
+ */
+typedef struct block_batch {
+	Pblock_cut_tree blocks;
+	block_solver solver;
+	Pgraph *trees;
+	int next;
+	boost::mutex lock;
+} block_batch, *Pblock_batch;
+
+static void init_int_array(int_array *a, int capacity){
+	a->capacity = capacity > 16 ? capacity : 16;
+	a->size = 0;
+	a->values = (int*)allocate(a->capacity*sizeof(int));
+}
+
+static void push_int_array(int_array *a, int value){
+	if (a->size == a->capacity){
+		a->capacity *= 2;
+		a->values = (int*)realloc(a->values,a->capacity*sizeof(int));
+		if (a->values == NULL){
+			exit(EXIT_FAILURE);
+		}
+	}
+	a->values[a->size++] = value;
+}
+
+/* pops the edges of the stack down to (p,u) : they are a new block */
+static void pop_block(Pblock_cut_tree t, int_array *stack, int_array *vertices, int_array *edges, int *stamp, int p, int u){
+	int x,y;
+	int b = t->blocks_number;
+
+	do {
+		y = stack->values[--stack->size];
+		x = stack->values[--stack->size];
+		push_int_array(edges,x);
+		push_int_array(edges,y);
+		if (stamp[x] != b){
+			stamp[x] = b;
+			push_int_array(vertices,x);
+		}
+		if (stamp[y] != b){
+			stamp[y] = b;
+			push_int_array(vertices,y);
+		}
+	} while (x != p || y != u);
+
+	t->blocks_number++;
+	t->block_start[t->blocks_number] = vertices->size;
+	t->edge_start[t->blocks_number] = edges->size/2;
+}
+
+Pblock_cut_tree new_block_cut_tree(Pgraph g){
+	int** am = g->adjacency_matrix;
+	int n = g->vertices_number;
+	int *disc = (int*)allocate((n+1)*sizeof(int));
+	int *low = (int*)allocate((n+1)*sizeof(int));
+	int *parent = (int*)allocate((n+1)*sizeof(int));
+	int *next = (int*)allocate((n+1)*sizeof(int));
+	int *call_stack = (int*)allocate((n+1)*sizeof(int));
+	int *stamp = (int*)allocate((n+1)*sizeof(int));
+	int_array stack, vertices, edges;
+	int counter = 0;
+	int call_top;
+	int root_children;
+	int root,u,w,p;
+	Pblock_cut_tree t = (block_cut_tree*)allocate(sizeof(block_cut_tree));
+
+	t->vertices_number = n;
+	t->blocks_number = 0;
+	t->articulations_number = 0;
+	t->articulation = (int*)allocate((n+1)*sizeof(int));
+	/* at most n-1 blocks in a forest of blocks */
+	t->block_start = (int*)allocate((n+1)*sizeof(int));
+	t->edge_start = (int*)allocate((n+1)*sizeof(int));
+	t->block_start[0] = 0;
+	t->edge_start[0] = 0;
+
+	init_int_array(&stack,2*g->edges_number);
+	init_int_array(&vertices,2*n);
+	init_int_array(&edges,2*g->edges_number);
+
+	for (u = 0; u < n; u++){
+		disc[u] = -1;
+		stamp[u] = -1;
+		t->articulation[u] = 0;
+	}
+
+	for (root = 0; root < n; root++){
+		if (disc[root] != -1){
+			continue;
+		}
+
+		disc[root] = low[root] = counter++;
+		parent[root] = -1;
+		next[root] = 0;
+		call_top = 0;
+		call_stack[call_top++] = root;
+		root_children = 0;
+
+		while (call_top > 0){
+			u = call_stack[call_top-1];
+
+			if (next[u] < n){
+				w = next[u]++;
+				if (!am[u][w] || w == u){
+					continue;
+				}
+				if (disc[w] == -1){
+					push_int_array(&stack,u);
+					push_int_array(&stack,w);
+					parent[w] = u;
+					disc[w] = low[w] = counter++;
+					next[w] = 0;
+					call_stack[call_top++] = w;
+					if (u == root){
+						root_children++;
+					}
+				}
+				else if (w != parent[u] && disc[w] < disc[u]){
+					push_int_array(&stack,u);
+					push_int_array(&stack,w);
+					if (disc[w] < low[u]){
+						low[u] = disc[w];
+					}
+				}
+				continue;
+			}
+
+			/* u is done */
+			call_top--;
+			p = parent[u];
+			if (p == -1){
+				continue;
+			}
+			if (low[u] < low[p]){
+				low[p] = low[u];
+			}
+			if (low[u] >= disc[p]){
+				pop_block(t,&stack,&vertices,&edges,stamp,p,u);
+				if (p != root || root_children > 1){
+					t->articulations_number += !t->articulation[p];
+					t->articulation[p] = 1;
+				}
+			}
+		}
+	}
+
+	t->block_vertices = vertices.values;
+	t->block_edges = edges.values;
+
+	free(stack.values);
+	free(disc);
+	free(low);
+	free(parent);
+	free(next);
+	free(call_stack);
+	free(stamp);
+
+	return t;
+}
+
+Pgraph get_block_cut_tree(Pblock_cut_tree t){
+	int b,k,v;
+	int *index = (int*)allocate((t->vertices_number+1)*sizeof(int));
+	Pgraph tree = new_graph(t->blocks_number + t->articulations_number);
+
+	k = t->blocks_number;
+	for (v = 0; v < t->vertices_number; v++){
+		index[v] = t->articulation[v] ? k++ : -1;
+	}
+
+	for (b = 0; b < t->blocks_number; b++){
+		for (k = t->block_start[b]; k < t->block_start[b+1]; k++){
+			v = t->block_vertices[k];
+			if (t->articulation[v]){
+				add_edge(tree,b,index[v]);
+			}
+		}
+	}
+
+	free(index);
+
+	return tree;
+}
+
+Pblock_cut_tree free_block_cut_tree(Pblock_cut_tree t){
+	free(t->block_start);
+	free(t->block_vertices);
+	free(t->edge_start);
+	free(t->block_edges);
+	free(t->articulation);
+	free(t);
+
+	return NULL;
+}
+
+/* the block b as a graph on the vertices 0 ... size-1 */
+static Pgraph get_block_graph(Pblock_cut_tree t, int b, int *local){
+	int k;
+	int size = t->block_start[b+1] - t->block_start[b];
+	Pgraph g = new_graph(size);
+
+	for (k = 0; k < size; k++){
+		local[t->block_vertices[t->block_start[b]+k]] = k;
+	}
+	for (k = t->edge_start[b]; k < t->edge_start[b+1]; k++){
+		add_edge(g,local[t->block_edges[2*k]],local[t->block_edges[2*k+1]]);
+	}
+
+	return g;
+}
+
+static Pgraph DFS_block_tree(Pgraph g){
+	Pspanning_tree t = DFS_tree(g);
+	Pgraph tree = spanning_tree_to_graph(t);
+
+	free_spanning_tree(t);
+
+	return tree;
+}
+
+static void solve_blocks_worker(Pblock_batch batch){
+	Pblock_cut_tree t = batch->blocks;
+	int *local = (int*)allocate((t->vertices_number+1)*sizeof(int));
+	Pgraph g;
+	int b;
+
+	while (1){
+		batch->lock.lock();
+		b = batch->next++;
+		batch->lock.unlock();
+
+		if (b >= t->blocks_number){
+			break;
+		}
+
+		g = get_block_graph(t,b,local);
+		/* a bridge is its own tree */
+		batch->trees[b] = g->edges_number == 1 ? copy_graph(g) : batch->solver(g);
+		/* the block keeps a tree even when the solver fails on it */
+		if (batch->trees[b] == NULL){
+			batch->trees[b] = DFS_block_tree(g);
+		}
+		free_graph(g);
+	}
+
+	free(local);
+}
+
+Pgraph solve_by_blocks(Pgraph g, block_solver solver, int threads){
+	Pblock_cut_tree t = new_block_cut_tree(g);
+	Pgraph tree = new_graph(g->vertices_number);
+	boost::thread_group workers;
+	block_batch batch;
+	int b,i,j,k;
+	int *vertices;
+
+	batch.blocks = t;
+	batch.solver = solver;
+	batch.trees = (Pgraph*)allocate((t->blocks_number+1)*sizeof(Pgraph));
+	batch.next = 0;
+
+	if (threads <= 0){
+		threads = boost::thread::hardware_concurrency();
+	}
+	if (threads > t->blocks_number){
+		threads = t->blocks_number;
+	}
+
+	if (threads <= 1){
+		solve_blocks_worker(&batch);
+	}
+	else {
+		for (k = 0; k < threads; k++){
+			workers.create_thread(boost::bind(solve_blocks_worker,&batch));
+		}
+		workers.join_all();
+	}
+
+	/* the degrees of the articulation vertices add up */
+	for (b = 0; b < t->blocks_number; b++){
+		vertices = t->block_vertices + t->block_start[b];
+		for (i = 0; i < batch.trees[b]->vertices_number; i++){
+			for (j = i+1; j < batch.trees[b]->vertices_number; j++){
+				if (batch.trees[b]->adjacency_matrix[i][j]){
+					add_edge(tree,vertices[i],vertices[j]);
+				}
+			}
+		}
+		free_graph(batch.trees[b]);
+	}
+
+	free(batch.trees);
+	free_block_cut_tree(t);
+
+	return tree;
+}
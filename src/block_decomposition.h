@@ -0,0 +1,104 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+/** @file block_decomposition.h
+ *
+ * @brief This file manages the decomposition of a graph into its biconnected
+ * blocks.
+ *
+ * The blocks of a connected graph only share articulation vertices and form a
+ * tree, so spanning trees of the blocks put together are a spanning tree of
+ * the graph. Each block is solved alone, then the degrees of the articulation
+ * vertices add up. It is a heuristic even with an exact solver : the optimum
+ * of each block does not take the degrees from the other blocks into account.
+ */
+
+#ifndef BLOCK__DECOMPOSITION__H
+#define BLOCK__DECOMPOSITION__H
+
+#include "include.h"
+#include "graph.h"
+
+/**
+ * A solver returns a spanning tree of a connected graph, for instance
+ * MBVST_graph or run_lp_tree.
+ */
+typedef Pgraph (*block_solver)(Pgraph g);
+
+/**
+ * \struct block_cut_tree
+ * \brief block-cut tree structure
+ *
+ * \a The vertices of block b are block_vertices[block_start[b]] ...
+ *  block_vertices[block_start[b+1]-1] and its edges are the pairs
+ *  block_edges[2k], block_edges[2k+1] for edge_start[b] <= k <
+ *  edge_start[b+1]. Every edge of the graph belongs to exactly one block.
+ */
+typedef struct block_cut_tree {
+	int vertices_number;
+	int blocks_number;
+	int * block_start;
+	int * block_vertices;
+	int * edge_start;
+	int * block_edges;
+	int * articulation;
+	int articulations_number;
+} block_cut_tree, *Pblock_cut_tree;
+
+/**
+ * This function computes the biconnected blocks and the articulation vertices
+ * of an undirected graph G, with an iterative Hopcroft-Tarjan algorithm.
+ * @param  g The graph G.
+ * @return   The block-cut tree of G.
+ */
+Pblock_cut_tree new_block_cut_tree(Pgraph g);
+
+/**
+ * This function returns the block-cut tree as a graph : the vertex b is the
+ * block b, the vertex blocks_number + k is the k-th articulation vertex (in
+ * increasing order) and a block is linked to the articulation vertices it
+ * contains.
+ * @param  t The block-cut tree.
+ * @return   The graph of the block-cut tree.
+ */
+Pgraph get_block_cut_tree(Pblock_cut_tree t);
+
+/**
+ * This function frees a block-cut tree.
+ * @param  t The block-cut tree.
+ * @return   A null pointer.
+ */
+Pblock_cut_tree free_block_cut_tree(Pblock_cut_tree t);
+
+/**
+ * This function computes a spanning tree of a connected graph G block by
+ * block : the blocks are given to the solver by a pool of threads, then their
+ * trees are put together. A block made of a single edge does not need the
+ * solver. When the solver returns NULL for a block, the block gets the tree
+ * of DFS_tree instead, so the result always spans G.
+ * @param  g       The graph G.
+ * @param  solver  The solver of the blocks.
+ * @param  threads The number of threads, 0 for one per core. The solver must
+ *                 be reentrant if it is greater than 1 (run_lp_tree is not).
+ * @return         The spanning tree of G.
+ */
+Pgraph solve_by_blocks(Pgraph g, block_solver solver, int threads);
+
+#endif
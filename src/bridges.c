@@ -0,0 +1,243 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "include.h"
+#include "bridges.h"
+#include "tools.h"
+
+/* the other end of the edge e */
+static int other_end(Pbridge_set s, int e, int v){
+	return s->edges[2*e] == v ? s->edges[2*e+1] : s->edges[2*e];
+}
+
+/* chain decomposition over the edges which are not removed */
+static void decompose(Pbridge_set s){
+	int n = s->vertices_number;
+	int *next = (int*)allocate((n+1)*sizeof(int));
+	int *stack = (int*)allocate((n+1)*sizeof(int));
+	int *order = (int*)allocate((n+1)*sizeof(int));
+	int visited = 0;
+	int top,root,u,w,e,k,p;
+
+	clean_edge_sampler(s->candidates);
+	s->components_number = 0;
+
+	for (u = 0; u < n; u++){
+		s->depth[u] = -1;
+		s->cover[u] = 0;
+	}
+	for (e = 0; e < s->edges_number; e++){
+		s->tree[e] = 0;
+	}
+
+	for (root = 0; root < n; root++){
+		if (s->depth[root] != -1){
+			continue;
+		}
+
+		s->representatives[s->components_number++] = root;
+		s->depth[root] = 0;
+		s->parent_edge[root] = -1;
+		next[root] = s->adjacency_start[root];
+		order[visited++] = root;
+		top = 0;
+		stack[top++] = root;
+
+		while (top > 0){
+			u = stack[top-1];
+			if (next[u] == s->adjacency_start[u+1]){
+				top--;
+				continue;
+			}
+
+			e = s->adjacency[next[u]++];
+			if (s->removed[e] || e == s->parent_edge[u]){
+				continue;
+			}
+			w = other_end(s,e,u);
+
+			if (s->depth[w] == -1){
+				s->tree[e] = 1;
+				s->parent_edge[w] = e;
+				s->depth[w] = s->depth[u]+1;
+				next[w] = s->adjacency_start[w];
+				order[visited++] = w;
+				stack[top++] = w;
+			}
+			else if (s->depth[w] < s->depth[u]){
+				/* a back edge covers the path from u up to w */
+				s->cover[u]++;
+				s->cover[w]--;
+				edge_sampler_add(s->candidates,u,w);
+			}
+		}
+	}
+
+	/* the cover of a vertex is the sum over its subtree */
+	for (k = visited-1; k >= 0; k--){
+		u = order[k];
+		e = s->parent_edge[u];
+		if (e == -1){
+			continue;
+		}
+		p = other_end(s,e,u);
+		s->cover[p] += s->cover[u];
+		if (s->cover[u] > 0){
+			edge_sampler_add(s->candidates,u,p);
+		}
+	}
+
+	s->stale = 0;
+	s->decompositions_number++;
+
+	free(next);
+	free(stack);
+	free(order);
+}
+
+Pbridge_set new_bridge_set(Pgraph g){
+	int** am = g->adjacency_matrix;
+	int n = g->vertices_number;
+	int i,j,e;
+	Pbridge_set s = (bridge_set*)allocate(sizeof(bridge_set));
+
+	s->g = g;
+	s->vertices_number = n;
+	s->edges_number = 0;
+	s->stale = 1;
+	s->decompositions_number = 0;
+	s->components_number = 0;
+
+	s->edges = (int*)allocate((2*g->edges_number+2)*sizeof(int));
+	s->adjacency_start = (int*)allocate((n+1)*sizeof(int));
+	s->ids = new_edge_table(g->edges_number);
+
+	for (i = 0; i <= n; i++){
+		s->adjacency_start[i] = 0;
+	}
+	for (i = 0; i < n; i++){
+		for (j = i+1; j < n; j++){
+			if (am[i][j] && s->edges_number < g->edges_number){
+				s->edges[2*s->edges_number] = i;
+				s->edges[2*s->edges_number+1] = j;
+				edge_table_put(s->ids,i,j,s->edges_number);
+				s->adjacency_start[i+1]++;
+				s->adjacency_start[j+1]++;
+				s->edges_number++;
+			}
+		}
+	}
+
+	for (i = 0; i < n; i++){
+		s->adjacency_start[i+1] += s->adjacency_start[i];
+	}
+	s->adjacency = (int*)allocate((2*s->edges_number+1)*sizeof(int));
+	for (e = 0; e < s->edges_number; e++){
+		s->adjacency[s->adjacency_start[s->edges[2*e]]++] = e;
+		s->adjacency[s->adjacency_start[s->edges[2*e+1]]++] = e;
+	}
+	for (i = n; i > 0; i--){
+		s->adjacency_start[i] = s->adjacency_start[i-1];
+	}
+	s->adjacency_start[0] = 0;
+
+	s->removed = (int*)calloc(s->edges_number+1,sizeof(int));
+	s->tree = (int*)allocate((s->edges_number+1)*sizeof(int));
+	if (s->removed == NULL){
+		exit(EXIT_FAILURE);
+	}
+	s->parent_edge = (int*)allocate((n+1)*sizeof(int));
+	s->depth = (int*)allocate((n+1)*sizeof(int));
+	s->cover = (int*)allocate((n+1)*sizeof(int));
+	s->representatives = (int*)allocate((n+1)*sizeof(int));
+	s->candidates = new_empty_edge_sampler(s->edges_number);
+
+	decompose(s);
+
+	return s;
+}
+
+int bridge_set_is_bridge(Pbridge_set s, int i, int j){
+	int e = edge_table_get(s->ids,i,j);
+
+	if (e == -1 || s->removed[e]){
+		return 0;
+	}
+	if (s->stale){
+		decompose(s);
+	}
+
+	return edge_table_get(s->candidates->positions,i,j) == -1;
+}
+
+int bridge_set_pick(Pbridge_set s, Prng r, int *i, int *j){
+	if (s->stale){
+		decompose(s);
+	}
+
+	return edge_sampler_pick(s->candidates,r,i,j);
+}
+
+int bridge_set_remove(Pbridge_set s, int i, int j){
+	int e = edge_table_get(s->ids,i,j);
+	int u,w,v,p;
+
+	if (e == -1 || s->removed[e] || bridge_set_is_bridge(s,i,j)){
+		return 0;
+	}
+
+	s->removed[e] = 1;
+	edge_sampler_remove(s->candidates,i,j);
+	remove_edge(s->g,i,j);
+
+	if (s->tree[e]){
+		s->stale = 1;
+		return 1;
+	}
+
+	/* the forest stays, the path of the back edge loses one cover */
+	u = s->depth[i] > s->depth[j] ? i : j;
+	w = other_end(s,e,u);
+	for (v = u; v != w; v = p){
+		p = other_end(s,s->parent_edge[v],v);
+		if (--s->cover[v] == 0){
+			edge_sampler_remove(s->candidates,v,p);
+		}
+	}
+
+	return 1;
+}
+
+Pbridge_set free_bridge_set(Pbridge_set s){
+	free(s->edges);
+	free(s->removed);
+	free(s->tree);
+	free(s->adjacency_start);
+	free(s->adjacency);
+	free(s->parent_edge);
+	free(s->depth);
+	free(s->cover);
+	free(s->representatives);
+	free_edge_table(s->ids);
+	free_edge_sampler(s->candidates);
+	free(s);
+
+	return NULL;
+}
@@ -0,0 +1,120 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+/** @file bridges.h
+ *
+ * @brief This file manages the bridges of a graph while its edges are removed.
+ *
+ * The bridges come from a chain decomposition : every edge out of a DFS forest
+ * covers the path of the forest between its two ends, and a forest edge is a
+ * bridge if no edge covers it. The structure keeps its own adjacency arrays,
+ * so the decomposition costs O(n + m).
+ *
+ * It is updated lazily. Removing an edge out of the forest only decreases the
+ * covers along its path, and the forest edges which are not covered anymore
+ * become bridges. Removing a forest edge breaks the forest, so the
+ * decomposition is only computed again before the next draw.
+ */
+
+#ifndef BRIDGES__H
+#define BRIDGES__H
+
+#include "include.h"
+#include "graph.h"
+#include "edge_table.h"
+#include "edge_sampler.h"
+#include "rng.h"
+
+/**
+ * \struct bridge_set
+ * \brief bridges structure
+ *
+ * \a The edges of the graph have an id, the edges of a vertex are
+ *  adjacency[adjacency_start[v]] ... adjacency[adjacency_start[v+1]-1]. The
+ *  vertex v is linked to its parent in the forest by the edge parent_edge[v]
+ *  (-1 for a root), which is covered by cover[v] edges. The edges which are
+ *  not bridges are in the sampler.
+ */
+typedef struct bridge_set {
+	Pgraph g;
+	int vertices_number;
+	int edges_number;
+	int * edges;
+	int * removed;
+	int * tree;
+	int * adjacency_start;
+	int * adjacency;
+	int * parent_edge;
+	int * depth;
+	int * cover;
+	int components_number;
+	int * representatives;
+	int stale;
+	int decompositions_number;
+	Pedge_table ids;
+	Pedge_sampler candidates;
+} bridge_set, *Pbridge_set;
+
+/**
+ * This function computes the bridges of an undirected graph G. The edges of G
+ * must then be removed with bridge_set_remove only. An edge added to G
+ * between two connected components is a bridge and does not change the
+ * structure.
+ * @param  g The graph G.
+ * @return   The bridges of G.
+ */
+Pbridge_set new_bridge_set(Pgraph g);
+
+/**
+ * This function tests if an edge is a bridge.
+ * @param  s The bridges.
+ * @param  i The first vertex of the edge.
+ * @param  j The second vertex of the edge.
+ * @return   1 if (i,j) is a bridge, 0 otherwise (or if it is not an edge).
+ */
+int bridge_set_is_bridge(Pbridge_set s, int i, int j);
+
+/**
+ * This function draws a uniform edge among the edges which are not bridges.
+ * @param  s The bridges.
+ * @param  r The random number generator.
+ * @param  i The first vertex of the edge drawn.
+ * @param  j The second vertex of the edge drawn.
+ * @return   1 if an edge was drawn, 0 if every edge is a bridge.
+ */
+int bridge_set_pick(Pbridge_set s, Prng r, int *i, int *j);
+
+/**
+ * This function removes an edge which is not a bridge from the graph.
+ * @param  s The bridges.
+ * @param  i The first vertex of the edge.
+ * @param  j The second vertex of the edge.
+ * @return   1 if the edge was removed, 0 if it is a bridge or not an edge.
+ */
+int bridge_set_remove(Pbridge_set s, int i, int j);
+
+/**
+ * This function frees the bridges, the graph stays.
+ * @param  s The bridges.
+ * @return   A null pointer.
+ */
+Pbridge_set free_bridge_set(Pbridge_set s);
+
+#endif
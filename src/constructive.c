@@ -0,0 +1,335 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "include.h"
+#include "constructive.h"
+#include "graph.h"
+#include "tools.h"
+#include "incidence.h"
+
+/**
+ * \struct tree_builder
+ * \brief state shared by the constructive heuristics
+ *
+ * \a unvisited[v] is the number of neighbours of v which are not visited
+ *  yet, it is kept up to date by visit.
+ */
+typedef struct tree_builder {
+	int vertices_number;
+	int edges_number;
+	int **edges_list;
+	Pincidence in;
+	char *visited;
+	int *unvisited;
+	Pspanning_tree tree;
+} tree_builder;
+
+static void init_builder(tree_builder *b, Pgraph g){
+	int v;
+	int n = g->vertices_number;
+
+	b->vertices_number = n;
+	b->edges_number = g->edges_number;
+	b->edges_list = get_edges_list(g);
+	b->in = new_incidence(b->edges_list,n,b->edges_number);
+	b->visited = (char*) calloc(n+1,sizeof(char));
+	b->unvisited = (int*) malloc((n+1)*sizeof(int));
+	b->tree = new_spanning_tree(n);
+
+	if (b->visited == NULL || b->unvisited == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	for (v = 0; v < n; v++){
+		b->unvisited[v] = b->in->start[v+1] - b->in->start[v];
+	}
+}
+
+/* everything but the tree is freed */
+static void free_builder(tree_builder *b){
+	free_matrix(b->edges_list,b->edges_number);
+	free_incidence(b->in);
+	free(b->visited);
+	free(b->unvisited);
+}
+
+static void visit(tree_builder *b, int v){
+	int k;
+
+	b->visited[v] = 1;
+	for (k = b->in->start[v]; k < b->in->start[v+1]; k++){
+		b->unvisited[incidence_other_end(b->edges_list,b->in->edges[k],v)]--;
+	}
+}
+
+/* the unvisited neighbour of v with the fewest unvisited neighbours, -1 if
+   there is none */
+static int next_vertex(tree_builder *b, int v){
+	int k,w;
+	int best = -1;
+
+	for (k = b->in->start[v]; k < b->in->start[v+1]; k++){
+		w = incidence_other_end(b->edges_list,b->in->edges[k],v);
+		if (!b->visited[w] && (best == -1 || b->unvisited[w] < b->unvisited[best]
+			|| (b->unvisited[w] == b->unvisited[best] && w < best))){
+			best = w;
+		}
+	}
+
+	return best;
+}
+
+/* the unvisited vertex of minimum degree, -1 if there is none */
+static int start_vertex(tree_builder *b){
+	int v;
+	int best = -1;
+
+	for (v = 0; v < b->vertices_number; v++){
+		if (!b->visited[v] && (best == -1 || b->unvisited[v] < b->unvisited[best])){
+			best = v;
+		}
+	}
+
+	return best;
+}
+
+Pspanning_tree DFS_tree(Pgraph g){
+	int s,v,w;
+	int top = 0;
+	tree_builder b;
+	int *stack;
+
+	init_builder(&b,g);
+	stack = (int*) malloc((b.vertices_number+1)*sizeof(int));
+	if (stack == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	/* one DFS by connected component */
+	while ((s = start_vertex(&b)) != -1){
+		visit(&b,s);
+		stack[top++] = s;
+
+		while (top > 0){
+			v = stack[top-1];
+			w = next_vertex(&b,v);
+			if (w == -1){
+				top--;
+				continue;
+			}
+			spanning_tree_add_edge(b.tree,v,w);
+			visit(&b,w);
+			stack[top++] = w;
+		}
+	}
+
+	free(stack);
+	free_builder(&b);
+
+	return b.tree;
+}
+
+Pspanning_tree greedy_degree_tree(Pgraph g){
+	int i,k,c,u,v,key;
+	int n = g->vertices_number;
+	int m = g->edges_number;
+	tree_builder b;
+	int *degree;
+	int *order = (int*) malloc((m+1)*sizeof(int));
+	int *count = (int*) calloc(2*n+2,sizeof(int));
+
+	if (order == NULL || count == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	init_builder(&b,g);
+	degree = b.tree->degree;
+
+	/* counting sort of the edges by the degrees of their ends in G (nothing is
+	   visited, unvisited is the degree) */
+	for (i = 0; i < m; i++){
+		key = b.unvisited[b.edges_list[i][0]] + b.unvisited[b.edges_list[i][1]];
+		count[key+1]++;
+	}
+	for (k = 0; k < 2*n; k++){
+		count[k+1] += count[k];
+	}
+	for (i = 0; i < m; i++){
+		key = b.unvisited[b.edges_list[i][0]] + b.unvisited[b.edges_list[i][1]];
+		order[count[key]++] = i;
+	}
+
+	/* c is the number of new branch vertices an edge may make */
+	for (c = 0; c <= 2; c++){
+		for (k = 0; k < m; k++){
+			u = b.edges_list[order[k]][0];
+			v = b.edges_list[order[k]][1];
+			if ((degree[u] == 2) + (degree[v] == 2) <= c && !spanning_tree_connected(b.tree,u,v)){
+				spanning_tree_add_edge(b.tree,u,v);
+			}
+		}
+	}
+
+	free(order);
+	free(count);
+	free_builder(&b);
+
+	return b.tree;
+}
+
+static void reverse_path(int *path, int *position, int i, int j){
+	int x;
+
+	while (i < j){
+		x = path[i];
+		path[i] = path[j];
+		path[j] = x;
+		position[path[i]] = i;
+		position[path[j]] = j;
+		i++;
+		j--;
+	}
+}
+
+/* the path grows at its end until neither a neighbour nor a rotation
+   extends it, path[0] does not move ; returns the new length */
+static int extend_path(tree_builder *b, int *path, int *position, int length){
+	int k,x,y,w,i;
+
+	while (1){
+		x = path[length-1];
+		w = next_vertex(b,x);
+		if (w != -1){
+			visit(b,w);
+			position[w] = length;
+			path[length++] = w;
+			continue;
+		}
+
+		/* a rotation only when the new end can grow, so it is followed by an
+		   extension */
+		i = -1;
+		for (k = b->in->start[x]; k < b->in->start[x+1] && i == -1; k++){
+			y = incidence_other_end(b->edges_list,b->in->edges[k],x);
+			if (position[y] != -1 && position[y] < length-2 && b->unvisited[path[position[y]+1]] > 0){
+				i = position[y];
+			}
+		}
+		if (i == -1){
+			break;
+		}
+		reverse_path(path,position,i+1,length-1);
+	}
+
+	return length;
+}
+
+Pspanning_tree hamiltonian_path_tree(Pgraph g){
+	int k,e,t,u,v,first,length;
+	int n = g->vertices_number;
+	int m = g->edges_number;
+	int top[2] = {0,0};
+	tree_builder b;
+	int *path = (int*) malloc((n+1)*sizeof(int));
+	int *position = (int*) malloc((n+1)*sizeof(int));
+	/* the joints (vertex of the tree, edge to an unvisited vertex) which
+	   make 0 or 1 new branch vertex */
+	int *joints[2];
+
+	joints[0] = (int*) malloc((4*m+2)*sizeof(int));
+	joints[1] = (int*) malloc((4*m+2)*sizeof(int));
+	if (path == NULL || position == NULL || joints[0] == NULL || joints[1] == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	init_builder(&b,g);
+	for (v = 0; v < n; v++){
+		position[v] = -1;
+	}
+
+	while (1){
+		/* the joint of the next path, to a leaf or a branch vertex first */
+		t = -1;
+		u = -1;
+		while (t == -1 && top[0] + top[1] > 0){
+			k = top[0] > 0 ? 0 : 1;
+			top[k] -= 2;
+			v = joints[k][top[k]];
+			e = joints[k][top[k]+1];
+			u = incidence_other_end(b.edges_list,e,v);
+			if (b.visited[u]){
+				continue;
+			}
+			if (k == 0 && b.tree->degree[v] == 2){
+				joints[1][top[1]++] = v;
+				joints[1][top[1]++] = e;
+				continue;
+			}
+			t = v;
+		}
+
+		first = t == -1;
+		if (first){
+			/* a new connected component */
+			u = start_vertex(&b);
+			if (u == -1){
+				break;
+			}
+		}
+
+		visit(&b,u);
+		path[0] = u;
+		position[u] = 0;
+		length = extend_path(&b,path,position,1);
+		if (first){
+			/* the other end of the first path grows too */
+			reverse_path(path,position,0,length-1);
+			length = extend_path(&b,path,position,length);
+		}
+		else{
+			spanning_tree_add_edge(b.tree,t,u);
+		}
+
+		for (k = 0; k < length; k++){
+			v = path[k];
+			if (k+1 < length){
+				spanning_tree_add_edge(b.tree,v,path[k+1]);
+			}
+			position[v] = -1;
+		}
+		for (k = 0; k < length; k++){
+			v = path[k];
+			for (e = b.in->start[v]; e < b.in->start[v+1]; e++){
+				if (!b.visited[incidence_other_end(b.edges_list,b.in->edges[e],v)]){
+					joints[0][top[0]++] = v;
+					joints[0][top[0]++] = b.in->edges[e];
+				}
+			}
+		}
+	}
+
+	free(joints[0]);
+	free(joints[1]);
+	free(path);
+	free(position);
+	free_builder(&b);
+
+	return b.tree;
+}
@@ -0,0 +1,70 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+/** @file constructive.h
+ *
+ * @brief This file manages the constructive heuristics of cover trees.
+ *
+ * They build a spanning tree with few branch vertices in one pass over the
+ * incident edges, in O(m) to O(n^2), much faster than MBVST. On a
+ * disconnected graph they return a spanning forest.
+ */
+
+#ifndef CONSTRUCTIVE__H
+#define CONSTRUCTIVE__H
+
+#include "include.h"
+#include "spanning_tree.h"
+
+/**
+ * This function builds a DFS tree of G which goes, from the top of the
+ * stack, to the unvisited neighbour with the fewest unvisited neighbours
+ * (Warnsdorff's rule), starting from a vertex of minimum degree. The long
+ * branches of the DFS leave few vertices to branch when it backtracks.
+ * @param  g The graph G.
+ * @return   The cover tree.
+ */
+Pspanning_tree DFS_tree(Pgraph g);
+
+/**
+ * This function builds a tree of G like Kruskal under a degree constraint :
+ * the edges are sorted by the sum of the degrees of their ends in G, then
+ * taken when they join two components and make no new branch vertex (the
+ * forest is a set of paths but for the branch vertices already made), then
+ * when they make at most one, then any of them.
+ * @param  g The graph G.
+ * @return   The cover tree.
+ */
+Pspanning_tree greedy_degree_tree(Pgraph g);
+
+/**
+ * This function builds a tree of G out of long paths. The first path is
+ * extended at both ends by Warnsdorff's rule and by Posa rotations when it
+ * is stuck : for a neighbour path[i] of the end, the path becomes
+ * path[0..i] and the reversed path[i+1..end], so path[i+1] is the new end.
+ * Then every new path starts at an unvisited vertex joined to a vertex of
+ * the tree which is a leaf or a branch vertex when there is one, so each
+ * path makes at most one branch vertex.
+ * @param  g The graph G.
+ * @return   The cover tree.
+ */
+Pspanning_tree hamiltonian_path_tree(Pgraph g);
+
+#endif
@@ -0,0 +1,631 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "include.h"
+#include "tools.h"
+#include "edge_table.h"
+#include "dynamic_connectivity.h"
+
+/**********************************/
+/*     Euler tour splay trees     */
+/**********************************/
+
+static void et_update(Pet_node x){
+	x->size = x->vertex >= 0 ? 1 : 0;
+	x->tree_edge = x->own_tree_edge;
+	x->non_tree_edge = x->own_non_tree_edge;
+
+	if (x->left){
+		x->size += x->left->size;
+		x->tree_edge |= x->left->tree_edge;
+		x->non_tree_edge |= x->left->non_tree_edge;
+	}
+	if (x->right){
+		x->size += x->right->size;
+		x->tree_edge |= x->right->tree_edge;
+		x->non_tree_edge |= x->right->non_tree_edge;
+	}
+}
+
+static void et_rotate(Pet_node x){
+	Pet_node p = x->parent;
+	Pet_node g = p->parent;
+
+	if (p->left == x){
+		p->left = x->right;
+		if (x->right) x->right->parent = p;
+		x->right = p;
+	}
+	else{
+		p->right = x->left;
+		if (x->left) x->left->parent = p;
+		x->left = p;
+	}
+
+	p->parent = x;
+	x->parent = g;
+
+	if (g){
+		if (g->left == p) g->left = x;
+		else g->right = x;
+	}
+
+	et_update(p);
+	et_update(x);
+}
+
+static void et_splay(Pet_node x){
+	Pet_node p,g;
+
+	while (x->parent){
+		p = x->parent;
+		g = p->parent;
+		if (g){
+			if ((g->left == p) == (p->left == x)) et_rotate(p);
+			else et_rotate(x);
+		}
+		et_rotate(x);
+	}
+}
+
+static Pet_node et_join(Pet_node a, Pet_node b){
+	if (a == NULL) return b;
+	if (b == NULL) return a;
+
+	while (a->right){
+		a = a->right;
+	}
+	et_splay(a);
+
+	a->right = b;
+	b->parent = a;
+	et_update(a);
+
+	return a;
+}
+
+static Pet_node et_reroot(Pet_node x){
+	Pet_node l;
+
+	et_splay(x);
+	l = x->left;
+	if (l == NULL){
+		return x;
+	}
+
+	l->parent = NULL;
+	x->left = NULL;
+	et_update(x);
+
+	return et_join(x,l);
+}
+
+static int et_connected(Pet_node x, Pet_node y){
+	if (x == y){
+		return 1;
+	}
+
+	/* if they share a tree, splaying y moves x away from the root */
+	et_splay(x);
+	et_splay(y);
+
+	return x->parent != NULL;
+}
+
+static Pet_node et_find(Pet_node x, int non_tree){
+	et_splay(x);
+
+	if (!(non_tree ? x->non_tree_edge : x->tree_edge)){
+		return NULL;
+	}
+
+	while (1){
+		if (x->left && (non_tree ? x->left->non_tree_edge : x->left->tree_edge)){
+			x = x->left;
+		}
+		else if (non_tree ? x->own_non_tree_edge : x->own_tree_edge){
+			break;
+		}
+		else{
+			x = x->right;
+		}
+	}
+
+	et_splay(x);
+	return x;
+}
+
+static void init_et_node(Pet_node x, int vertex, int edge){
+	x->left = NULL;
+	x->right = NULL;
+	x->parent = NULL;
+	x->vertex = vertex;
+	x->edge = edge;
+	x->own_tree_edge = 0;
+	x->own_non_tree_edge = 0;
+	et_update(x);
+}
+
+/**********************************/
+/*        Levels and edges        */
+/**********************************/
+
+static void allocate_level(Pconnectivity c, int level){
+	int v;
+	int n = c->vertices_number;
+
+	if (c->vertices[level] != NULL){
+		return;
+	}
+
+	c->vertices[level] = (Pet_node)malloc(n * sizeof(et_node));
+	c->non_tree_edges[level] = (int**)calloc(n,sizeof(int*));
+	c->non_tree_size[level] = (int*)calloc(n,sizeof(int));
+	c->non_tree_capacity[level] = (int*)calloc(n,sizeof(int));
+
+	if (c->vertices[level] == NULL || c->non_tree_edges[level] == NULL ||
+		c->non_tree_size[level] == NULL || c->non_tree_capacity[level] == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	for (v = 0; v < n; v++){
+		init_et_node(&c->vertices[level][v],v,-1);
+	}
+}
+
+static void set_non_tree_flag(Pconnectivity c, int level, int v){
+	Pet_node x = &c->vertices[level][v];
+
+	et_splay(x);
+	x->own_non_tree_edge = c->non_tree_size[level][v] > 0;
+	et_update(x);
+}
+
+static int push_non_tree_edge(Pconnectivity c, int level, int v, int id){
+	int size = c->non_tree_size[level][v];
+	int capacity = c->non_tree_capacity[level][v];
+
+	if (size == capacity){
+		capacity = capacity ? 2*capacity : 4;
+		c->non_tree_edges[level][v] = (int*)realloc(c->non_tree_edges[level][v],capacity*sizeof(int));
+		if (c->non_tree_edges[level][v] == NULL){
+			exit(EXIT_FAILURE);
+		}
+		c->non_tree_capacity[level][v] = capacity;
+	}
+
+	c->non_tree_edges[level][v][size] = id;
+	c->non_tree_size[level][v] = size+1;
+
+	if (size == 0){
+		set_non_tree_flag(c,level,v);
+	}
+
+	return size;
+}
+
+static void pop_non_tree_edge(Pconnectivity c, int level, int v, int position){
+	int size = c->non_tree_size[level][v] - 1;
+	int last = c->non_tree_edges[level][v][size];
+
+	c->non_tree_edges[level][v][position] = last;
+	c->non_tree_size[level][v] = size;
+
+	if (c->edges[last].u == v){
+		c->edges[last].position_u = position;
+	}
+	else{
+		c->edges[last].position_v = position;
+	}
+
+	if (size == 0){
+		set_non_tree_flag(c,level,v);
+	}
+}
+
+static void add_non_tree_edge(Pconnectivity c, int id){
+	Pdc_edge e = &c->edges[id];
+
+	e->position_u = push_non_tree_edge(c,e->level,e->u,id);
+	e->position_v = push_non_tree_edge(c,e->level,e->v,id);
+}
+
+static void remove_non_tree_edge(Pconnectivity c, int id){
+	Pdc_edge e = &c->edges[id];
+
+	pop_non_tree_edge(c,e->level,e->u,e->position_u);
+	pop_non_tree_edge(c,e->level,e->v,e->position_v);
+}
+
+static void link_tree_edge(Pconnectivity c, int level, int id){
+	Pdc_edge e = &c->edges[id];
+	Pet_node a = (Pet_node)malloc(2 * sizeof(et_node));
+	Pet_node tu,tv;
+
+	if (a == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	init_et_node(&a[0],-1,id);
+	init_et_node(&a[1],-1,id);
+	a[0].own_tree_edge = level == e->level;
+	et_update(&a[0]);
+	e->arcs[level] = a;
+
+	/* the tour of the new tree is u ... (u,v) v ... (v,u) */
+	tu = et_reroot(&c->vertices[level][e->u]);
+	tv = et_reroot(&c->vertices[level][e->v]);
+	et_join(et_join(et_join(tu,&a[0]),tv),&a[1]);
+}
+
+static void cut_tree_edge(Pconnectivity c, int level, int id){
+	Pdc_edge e = &c->edges[id];
+	Pet_node a = e->arcs[level];
+	Pet_node b = a+1;
+	Pet_node l,r,bl,br;
+	int b_on_right;
+
+	et_splay(a);
+	l = a->left;
+	r = a->right;
+	if (l) l->parent = NULL;
+	if (r) r->parent = NULL;
+
+	et_splay(b);
+	b_on_right = r != NULL && (r == b || r->parent != NULL);
+	bl = b->left;
+	br = b->right;
+	if (bl) bl->parent = NULL;
+	if (br) br->parent = NULL;
+
+	/* the subtree under (u,v) is the part between the two arcs */
+	if (b_on_right){
+		et_join(l,br);
+	}
+	else{
+		et_join(bl,r);
+	}
+
+	free(a);
+	e->arcs[level] = NULL;
+}
+
+static void make_tree_edge(Pconnectivity c, int id, int level){
+	int i;
+	Pdc_edge e = &c->edges[id];
+
+	e->tree = 1;
+	e->level = level;
+	e->arcs = (Pet_node*)calloc(c->levels_number,sizeof(Pet_node));
+
+	if (e->arcs == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	for (i = 0; i <= level; i++){
+		link_tree_edge(c,i,id);
+	}
+}
+
+static int new_dc_edge(Pconnectivity c, int u, int v){
+	int id;
+	Pdc_edge e;
+
+	if (c->free_edges_number > 0){
+		id = c->free_edges[--c->free_edges_number];
+	}
+	else{
+		if (c->edges_number == c->edges_capacity){
+			c->edges_capacity = c->edges_capacity ? 2*c->edges_capacity : 16;
+			c->edges = (Pdc_edge)realloc(c->edges,c->edges_capacity*sizeof(dc_edge));
+			c->free_edges = (int*)realloc(c->free_edges,c->edges_capacity*sizeof(int));
+			if (c->edges == NULL || c->free_edges == NULL){
+				exit(EXIT_FAILURE);
+			}
+		}
+		id = c->edges_number++;
+	}
+
+	e = &c->edges[id];
+	e->u = u;
+	e->v = v;
+	e->level = 0;
+	e->tree = 0;
+	e->position_u = -1;
+	e->position_v = -1;
+	e->arcs = NULL;
+
+	return id;
+}
+
+static void free_dc_edge(Pconnectivity c, int id){
+	free(c->edges[id].arcs);
+	c->edges[id].arcs = NULL;
+	c->free_edges[c->free_edges_number++] = id;
+}
+
+/*
+ * Looks for a replacement of a deleted tree edge (u,v) of level `level`. The
+ * tree edges of the smaller side go up one level, then its non tree edges are
+ * examined : those staying inside the smaller side go up one level too, the
+ * first one leaving it becomes a tree edge.
+ */
+static int replace_tree_edge(Pconnectivity c, int level, int u, int v){
+	Pet_node x = &c->vertices[level][u];
+	Pet_node y = &c->vertices[level][v];
+	Pet_node small,found;
+	Pdc_edge f;
+	int size_x,w,id,other;
+
+	et_splay(x);
+	size_x = x->size;
+	et_splay(y);
+	small = size_x <= y->size ? x : y;
+
+	while ((found = et_find(small,0)) != NULL){
+		id = found->edge;
+		f = &c->edges[id];
+		found->own_tree_edge = 0;
+		et_update(found);
+
+		f->level = level+1;
+		allocate_level(c,level+1);
+		link_tree_edge(c,level+1,id);
+	}
+
+	while ((found = et_find(small,1)) != NULL){
+		w = found->vertex;
+
+		while (c->non_tree_size[level][w] > 0){
+			id = c->non_tree_edges[level][w][c->non_tree_size[level][w]-1];
+			f = &c->edges[id];
+			other = f->u == w ? f->v : f->u;
+			remove_non_tree_edge(c,id);
+
+			if (et_connected(&c->vertices[level][other],small)){
+				f->level = level+1;
+				allocate_level(c,level+1);
+				add_non_tree_edge(c,id);
+			}
+			else{
+				make_tree_edge(c,id,level);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static void init_connectivity(Pconnectivity c, int n){
+	int levels = 2;
+
+	while ((1 << (levels-1)) < n){
+		levels++;
+	}
+
+	c->vertices_number = n;
+	c->levels_number = levels;
+	c->components_number = n;
+
+	c->vertices = (Pet_node*)calloc(levels,sizeof(Pet_node));
+	c->non_tree_edges = (int***)calloc(levels,sizeof(int**));
+	c->non_tree_size = (int**)calloc(levels,sizeof(int*));
+	c->non_tree_capacity = (int**)calloc(levels,sizeof(int*));
+
+	if (c->vertices == NULL || c->non_tree_edges == NULL ||
+		c->non_tree_size == NULL || c->non_tree_capacity == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	c->edges = NULL;
+	c->edges_number = 0;
+	c->edges_capacity = 0;
+	c->free_edges = NULL;
+	c->free_edges_number = 0;
+	c->edges_index = new_edge_table(n);
+
+	allocate_level(c,0);
+}
+
+static void release_connectivity(Pconnectivity c){
+	int i,v;
+
+	for (i = 0; i < c->edges_number; i++){
+		if (c->edges[i].arcs){
+			for (v = 0; v < c->levels_number; v++){
+				free(c->edges[i].arcs[v]);
+			}
+			free(c->edges[i].arcs);
+		}
+	}
+
+	for (i = 0; i < c->levels_number; i++){
+		if (c->vertices[i]){
+			for (v = 0; v < c->vertices_number; v++){
+				free(c->non_tree_edges[i][v]);
+			}
+			free(c->vertices[i]);
+			free(c->non_tree_edges[i]);
+			free(c->non_tree_size[i]);
+			free(c->non_tree_capacity[i]);
+		}
+	}
+
+	free(c->vertices);
+	free(c->non_tree_edges);
+	free(c->non_tree_size);
+	free(c->non_tree_capacity);
+	free(c->edges);
+	free(c->free_edges);
+	free_edge_table(c->edges_index);
+}
+
+/**********************************/
+/*           Public API           */
+/**********************************/
+
+Pconnectivity new_connectivity(int n){
+	Pconnectivity c = (connectivity*) malloc(sizeof(connectivity));
+
+	if (c == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	init_connectivity(c,n);
+
+	return c;
+}
+
+void connectivity_add_edge(Pconnectivity c, int i, int j){
+	int id;
+
+	if (i == j || edge_table_get(c->edges_index,i,j) != -1){
+		return;
+	}
+
+	id = new_dc_edge(c,i,j);
+	edge_table_put(c->edges_index,i,j,id);
+
+	if (!et_connected(&c->vertices[0][i],&c->vertices[0][j])){
+		make_tree_edge(c,id,0);
+		c->components_number--;
+	}
+	else{
+		add_non_tree_edge(c,id);
+	}
+}
+
+void connectivity_remove_edge(Pconnectivity c, int i, int j){
+	int id = edge_table_remove(c->edges_index,i,j);
+	int level,u,v,l;
+	Pdc_edge e;
+
+	if (id == -1){
+		return;
+	}
+
+	e = &c->edges[id];
+
+	if (!e->tree){
+		remove_non_tree_edge(c,id);
+		free_dc_edge(c,id);
+		return;
+	}
+
+	level = e->level;
+	u = e->u;
+	v = e->v;
+
+	for (l = 0; l <= level; l++){
+		cut_tree_edge(c,l,id);
+	}
+	free_dc_edge(c,id);
+
+	for (l = level; l >= 0; l--){
+		if (replace_tree_edge(c,l,u,v)){
+			return;
+		}
+	}
+
+	c->components_number++;
+}
+
+int connectivity_connected(Pconnectivity c, int i, int j){
+	return et_connected(&c->vertices[0][i],&c->vertices[0][j]);
+}
+
+int connectivity_components_number(Pconnectivity c){
+	return c->components_number;
+}
+
+int connectivity_component_size(Pconnectivity c, int v){
+	Pet_node x = &c->vertices[0][v];
+
+	et_splay(x);
+	return x->size;
+}
+
+int connectivity_representative(Pconnectivity c, int v){
+	Pet_node x = &c->vertices[0][v];
+
+	/* the first vertex of the Euler tour */
+	et_splay(x);
+	while (1){
+		if (x->left && x->left->size > 0){
+			x = x->left;
+		}
+		else if (x->vertex >= 0){
+			break;
+		}
+		else{
+			x = x->right;
+		}
+	}
+	et_splay(x);
+
+	return x->vertex;
+}
+
+int** connectivity_non_tree_edges(Pconnectivity c, int *size){
+	int i,k;
+	Pdc_edge e;
+	int **edges_list;
+
+	/* the free slots are skipped thanks to the index */
+	k = 0;
+	for (i = 0; i < c->edges_number; i++){
+		e = &c->edges[i];
+		if (!e->tree && edge_table_get(c->edges_index,e->u,e->v) == i){
+			k++;
+		}
+	}
+
+	allocate_matrix(&edges_list,k,2);
+
+	k = 0;
+	for (i = 0; i < c->edges_number; i++){
+		e = &c->edges[i];
+		if (!e->tree && edge_table_get(c->edges_index,e->u,e->v) == i){
+			edges_list[k][0] = e->u;
+			edges_list[k][1] = e->v;
+			k++;
+		}
+	}
+
+	*size = k;
+	return edges_list;
+}
+
+Pconnectivity clean_connectivity(Pconnectivity c){
+	int n = c->vertices_number;
+
+	release_connectivity(c);
+	init_connectivity(c,n);
+
+	return c;
+}
+
+Pconnectivity free_connectivity(Pconnectivity c){
+	release_connectivity(c);
+	free(c);
+
+	return NULL;
+}
@@ -0,0 +1,185 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+/** @file dynamic_connectivity.h
+ *
+ * @brief This file manages the fully dynamic connectivity structure.
+ *
+ * It is the Holm, de Lichtenberg and Thorup structure : every edge has a
+ * level, the spanning forest of the edges of level >= i is kept as Euler tour
+ * trees (splay trees) and a deleted tree edge is replaced by searching the
+ * smaller side only, promoting the edges that were looked at. Insertions and
+ * deletions cost O(log^2 n) amortized, connectivity queries O(log n).
+ */
+
+#ifndef DYNAMIC__CONNECTIVITY__H
+#define DYNAMIC__CONNECTIVITY__H
+
+#include "include.h"
+#include "edge_table.h"
+
+/**
+ * \struct et_node
+ * \brief Euler tour tree node
+ *
+ * \a A node is either the (unique) occurrence of a vertex or one of the two
+ *  arcs of a tree edge in the Euler tour of a spanning tree of one level.
+ */
+typedef struct et_node {
+	struct et_node * left;
+	struct et_node * right;
+	struct et_node * parent;
+	int vertex;
+	int edge;
+	int size;
+	char own_tree_edge;
+	char own_non_tree_edge;
+	char tree_edge;
+	char non_tree_edge;
+} et_node, *Pet_node;
+
+/**
+ * \struct dc_edge
+ * \brief edge of the dynamic connectivity structure
+ *
+ * \a An edge knows its level, if it belongs to the spanning forest (then
+ *  arcs[i] holds its two Euler tour arcs in the forest of level i, for each
+ *  level up to its own) and otherwise its positions in the non tree edges
+ *  lists of its two vertices.
+ */
+typedef struct dc_edge {
+	int u;
+	int v;
+	int level;
+	int tree;
+	int position_u;
+	int position_v;
+	Pet_node * arcs;
+} dc_edge, *Pdc_edge;
+
+/**
+ * \struct connectivity
+ * \brief dynamic connectivity structure
+ *
+ * \a The structure is created for a fixed number of vertices. Levels are
+ *  allocated lazily, when a first edge is promoted to them.
+ */
+typedef struct connectivity {
+	int vertices_number;
+	int levels_number;
+	int components_number;
+
+	Pet_node * vertices;
+	int *** non_tree_edges;
+	int ** non_tree_size;
+	int ** non_tree_capacity;
+
+	Pdc_edge edges;
+	int edges_number;
+	int edges_capacity;
+	int * free_edges;
+	int free_edges_number;
+	Pedge_table edges_index;
+} connectivity, *Pconnectivity;
+
+/**
+ * This function returns a new connectivity structure without any edge.
+ * @param  n The number of vertices.
+ * @return   A new connectivity structure.
+ */
+Pconnectivity new_connectivity(int n);
+
+/**
+ * This function adds an edge to the structure. Nothing is done if the edge
+ * is a loop or is already present.
+ * @param c The connectivity structure.
+ * @param i The first vertex of the edge.
+ * @param j The second vertex of the edge.
+ */
+void connectivity_add_edge(Pconnectivity c, int i, int j);
+
+/**
+ * This function removes an edge from the structure. If it was a spanning
+ * forest edge, a replacement edge is searched for.
+ * @param c The connectivity structure.
+ * @param i The first vertex of the edge.
+ * @param j The second vertex of the edge.
+ */
+void connectivity_remove_edge(Pconnectivity c, int i, int j);
+
+/**
+ * This function tests if two vertices are in the same connected component.
+ * @param  c The connectivity structure.
+ * @param  i The first vertex.
+ * @param  j The second vertex.
+ * @return   1 if true, otherwise 0.
+ */
+int connectivity_connected(Pconnectivity c, int i, int j);
+
+/**
+ * This function returns the number of connected components.
+ * @param  c The connectivity structure.
+ * @return   The number of connected components.
+ */
+int connectivity_components_number(Pconnectivity c);
+
+/**
+ * This function returns the size of the connected component of a vertex.
+ * @param  c The connectivity structure.
+ * @param  v The vertex.
+ * @return   The number of vertices of its connected component.
+ */
+int connectivity_component_size(Pconnectivity c, int v);
+
+/**
+ * This function returns a representative vertex of the connected component
+ * of v. Two vertices have the same representative if and only if they are
+ * connected, as long as the structure is not modified between the calls.
+ * @param  c The connectivity structure.
+ * @param  v The vertex.
+ * @return   The representative of the connected component of v.
+ */
+int connectivity_representative(Pconnectivity c, int v);
+
+/**
+ * This function returns the edges which are not in the spanning forest kept
+ * by the structure. Removing any of them never disconnects the graph.
+ * @param  c    The connectivity structure.
+ * @param  size The number of edges returned.
+ * @return      The list of the non tree edges (size x 2, free it with
+ *              free_matrix).
+ */
+int** connectivity_non_tree_edges(Pconnectivity c, int *size);
+
+/**
+ * This function removes all the edges of the structure.
+ * @param  c The connectivity structure.
+ * @return   The cleaned structure.
+ */
+Pconnectivity clean_connectivity(Pconnectivity c);
+
+/**
+ * This function frees a connectivity structure allocated in the heap.
+ * @param  c The connectivity structure.
+ * @return   A null pointer.
+ */
+Pconnectivity free_connectivity(Pconnectivity c);
+
+#endif
@@ -0,0 +1,155 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "include.h"
+#include "edge_sampler.h"
+
+static void swap_positions(Pedge_sampler s, int a, int b){
+	int x = s->edges[2*a];
+	int y = s->edges[2*a+1];
+
+	s->edges[2*a] = s->edges[2*b];
+	s->edges[2*a+1] = s->edges[2*b+1];
+	s->edges[2*b] = x;
+	s->edges[2*b+1] = y;
+
+	edge_table_put(s->positions,s->edges[2*a],s->edges[2*a+1],a);
+	edge_table_put(s->positions,x,y,b);
+}
+
+Pedge_sampler new_empty_edge_sampler(int capacity){
+	Pedge_sampler s = (edge_sampler*) malloc(sizeof(edge_sampler));
+
+	if (s == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	s->capacity = capacity > 16 ? capacity : 16;
+	s->edges = (int*) malloc(2*s->capacity*sizeof(int));
+	if (s->edges == NULL){
+		exit(EXIT_FAILURE);
+	}
+	s->edges_number = 0;
+	s->candidates_number = 0;
+	s->positions = new_edge_table(s->capacity);
+
+	return s;
+}
+
+Pedge_sampler clean_edge_sampler(Pedge_sampler s){
+	s->edges_number = 0;
+	s->candidates_number = 0;
+	clean_edge_table(s->positions);
+
+	return s;
+}
+
+Pedge_sampler new_edge_sampler(Pgraph g){
+	int i,j;
+	int size = g->vertices_number;
+	Pedge_sampler s = new_empty_edge_sampler(g->edges_number);
+
+	for (i = 0; i < size; i++){
+		for (j = i+1; j < size; j++){
+			if (g->adjacency_matrix[i][j] == 1){
+				edge_sampler_add(s,i,j);
+			}
+		}
+	}
+
+	return s;
+}
+
+void edge_sampler_add(Pedge_sampler s, int i, int j){
+	s->candidates_number = s->edges_number;
+
+	if (edge_table_get(s->positions,i,j) != -1){
+		return;
+	}
+
+	if (s->edges_number == s->capacity){
+		s->capacity *= 2;
+		s->edges = (int*) realloc(s->edges,2*s->capacity*sizeof(int));
+		if (s->edges == NULL){
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	s->edges[2*s->edges_number] = i;
+	s->edges[2*s->edges_number+1] = j;
+	edge_table_put(s->positions,i,j,s->edges_number);
+	s->edges_number++;
+	s->candidates_number++;
+}
+
+void edge_sampler_remove(Pedge_sampler s, int i, int j){
+	int k = edge_table_get(s->positions,i,j);
+
+	if (k == -1){
+		return;
+	}
+
+	/* a candidate first goes to the end of the candidates */
+	if (k < s->candidates_number){
+		swap_positions(s,k,s->candidates_number-1);
+		k = --s->candidates_number;
+	}
+	swap_positions(s,k,s->edges_number-1);
+
+	s->edges_number--;
+	edge_table_remove(s->positions,i,j);
+}
+
+void edge_sampler_park(Pedge_sampler s, int i, int j){
+	int k = edge_table_get(s->positions,i,j);
+
+	if (k == -1 || k >= s->candidates_number){
+		return;
+	}
+
+	swap_positions(s,k,s->candidates_number-1);
+	s->candidates_number--;
+}
+
+void edge_sampler_unpark(Pedge_sampler s){
+	s->candidates_number = s->edges_number;
+}
+
+int edge_sampler_pick(Pedge_sampler s, Prng r, int *i, int *j){
+	int k;
+
+	if (s->candidates_number == 0){
+		return 0;
+	}
+
+	k = rng_uniform(r,s->candidates_number);
+	*i = s->edges[2*k];
+	*j = s->edges[2*k+1];
+
+	return 1;
+}
+
+Pedge_sampler free_edge_sampler(Pedge_sampler s){
+	free(s->edges);
+	free_edge_table(s->positions);
+	free(s);
+
+	return NULL;
+}
@@ -0,0 +1,122 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+/** @file edge_sampler.h
+ *
+ * @brief This file manages the uniform sampling of the edges of a graph.
+ */
+
+#ifndef EDGE__SAMPLER__H
+#define EDGE__SAMPLER__H
+
+#include "include.h"
+#include "graph.h"
+#include "edge_table.h"
+#include "rng.h"
+
+/**
+ * \struct edge_sampler
+ * \brief edge sampler structure
+ *
+ * \a An edge sampler keeps the edges of a graph in an array, with the position
+ *  of every edge in an edge table, so that an edge is drawn, added or removed
+ *  in O(1). The first candidates_number edges can be drawn, the others are
+ *  parked (for instance because they are bridges) until an edge is added.
+ */
+typedef struct edge_sampler {
+	int * edges;
+	int edges_number;
+	int capacity;
+	int candidates_number;
+	Pedge_table positions;
+} edge_sampler, *Pedge_sampler;
+
+/**
+ * This function returns a new edge sampler filled with the edges of G.
+ * @param  g The graph G.
+ * @return   A new edge sampler.
+ */
+Pedge_sampler new_edge_sampler(Pgraph g);
+
+/**
+ * This function returns a new empty edge sampler.
+ * @param  capacity The number of edges we expect to store.
+ * @return          A new edge sampler.
+ */
+Pedge_sampler new_empty_edge_sampler(int capacity);
+
+/**
+ * This function removes all the edges of a sampler.
+ * @param  s The edge sampler.
+ * @return   The empty edge sampler.
+ */
+Pedge_sampler clean_edge_sampler(Pedge_sampler s);
+
+/**
+ * This function adds an edge to the sampler, if it is not already in it. All
+ * the parked edges can be drawn again.
+ * @param s The edge sampler.
+ * @param i The first vertex of the edge.
+ * @param j The second vertex of the edge.
+ */
+void edge_sampler_add(Pedge_sampler s, int i, int j);
+
+/**
+ * This function removes an edge from the sampler, the last edge takes its
+ * place.
+ * @param s The edge sampler.
+ * @param i The first vertex of the edge.
+ * @param j The second vertex of the edge.
+ */
+void edge_sampler_remove(Pedge_sampler s, int i, int j);
+
+/**
+ * This function parks an edge : it stays in the sampler but can not be drawn
+ * until the next edge_sampler_add.
+ * @param s The edge sampler.
+ * @param i The first vertex of the edge.
+ * @param j The second vertex of the edge.
+ */
+void edge_sampler_park(Pedge_sampler s, int i, int j);
+
+/**
+ * This function makes all the parked edges drawable again.
+ * @param s The edge sampler.
+ */
+void edge_sampler_unpark(Pedge_sampler s);
+
+/**
+ * This function draws a uniform edge among the edges which are not parked.
+ * @param  s The edge sampler.
+ * @param  r The random number generator.
+ * @param  i The first vertex of the edge drawn.
+ * @param  j The second vertex of the edge drawn.
+ * @return   1 if an edge was drawn, 0 if there is no edge to draw.
+ */
+int edge_sampler_pick(Pedge_sampler s, Prng r, int *i, int *j);
+
+/**
+ * This function frees an edge sampler.
+ * @param  s The edge sampler.
+ * @return   A null pointer.
+ */
+Pedge_sampler free_edge_sampler(Pedge_sampler s);
+
+#endif
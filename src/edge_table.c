@@ -0,0 +1,181 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "include.h"
+#include "edge_table.h"
+
+long long edge_key(int i, int j){
+	if (i > j){
+		return ((long long)j << 32) | (unsigned int)i;
+	}
+	return ((long long)i << 32) | (unsigned int)j;
+}
+
+static int edge_slot(Pedge_table t, long long key){
+	unsigned long long h = (unsigned long long)key;
+
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+
+	return (int)(h & (unsigned long long)(t->capacity - 1));
+}
+
+static void allocate_edge_table(Pedge_table t, int capacity){
+	int i;
+
+	t->keys = (long long*)malloc(capacity * sizeof(long long));
+	t->values = (int*)malloc(capacity * sizeof(int));
+
+	if (t->keys == NULL || t->values == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	for (i = 0; i < capacity; i++){
+		t->keys[i] = -1;
+	}
+
+	t->capacity = capacity;
+	t->size = 0;
+}
+
+static void grow_edge_table(Pedge_table t){
+	int i;
+	int old_capacity = t->capacity;
+	long long* old_keys = t->keys;
+	int* old_values = t->values;
+
+	allocate_edge_table(t,2*old_capacity);
+
+	for (i = 0; i < old_capacity; i++){
+		if (old_keys[i] != -1){
+			edge_table_put(t,(int)(old_keys[i] >> 32),(int)(old_keys[i] & 0xffffffff),old_values[i]);
+		}
+	}
+
+	free(old_keys);
+	free(old_values);
+}
+
+Pedge_table new_edge_table(int capacity){
+	int size = 16;
+	Pedge_table t = (edge_table*) malloc(sizeof(edge_table));
+
+	if (t == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	/* keep the load factor under 1/2 */
+	while (size < 2*capacity){
+		size *= 2;
+	}
+
+	allocate_edge_table(t,size);
+
+	return t;
+}
+
+int edge_table_get(Pedge_table t, int i, int j){
+	long long key = edge_key(i,j);
+	int k = edge_slot(t,key);
+
+	while (t->keys[k] != -1){
+		if (t->keys[k] == key){
+			return t->values[k];
+		}
+		k = (k+1) & (t->capacity-1);
+	}
+
+	return -1;
+}
+
+void edge_table_put(Pedge_table t, int i, int j, int value){
+	long long key;
+	int k;
+
+	if (2*(t->size+1) > t->capacity){
+		grow_edge_table(t);
+	}
+
+	key = edge_key(i,j);
+	k = edge_slot(t,key);
+
+	while (t->keys[k] != -1 && t->keys[k] != key){
+		k = (k+1) & (t->capacity-1);
+	}
+
+	if (t->keys[k] == -1){
+		t->keys[k] = key;
+		t->size++;
+	}
+	t->values[k] = value;
+}
+
+int edge_table_remove(Pedge_table t, int i, int j){
+	long long key = edge_key(i,j);
+	int k = edge_slot(t,key);
+	int mask = t->capacity-1;
+	int value,next,home;
+
+	while (t->keys[k] != key){
+		if (t->keys[k] == -1){
+			return -1;
+		}
+		k = (k+1) & mask;
+	}
+
+	value = t->values[k];
+
+	/* backward shift deletion : no tombstone is left behind */
+	next = (k+1) & mask;
+	while (t->keys[next] != -1){
+		home = edge_slot(t,t->keys[next]);
+		if (((next - home) & mask) >= ((next - k) & mask)){
+			t->keys[k] = t->keys[next];
+			t->values[k] = t->values[next];
+			k = next;
+		}
+		next = (next+1) & mask;
+	}
+
+	t->keys[k] = -1;
+	t->size--;
+
+	return value;
+}
+
+Pedge_table clean_edge_table(Pedge_table t){
+	int i;
+
+	for (i = 0; i < t->capacity; i++){
+		t->keys[i] = -1;
+	}
+	t->size = 0;
+
+	return t;
+}
+
+Pedge_table free_edge_table(Pedge_table t){
+	free(t->keys);
+	free(t->values);
+	free(t);
+
+	return NULL;
+}
@@ -0,0 +1,103 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+/** @file edge_table.h
+ *
+ * @brief This file manages a hash table indexed by undirected edges.
+ */
+
+#ifndef EDGE__TABLE__H
+#define EDGE__TABLE__H
+
+#include "include.h"
+
+/**
+ * \struct edge_table
+ * \brief hash table structure
+ *
+ * \a An edge table associates an integer to an undirected edge (i,j). It uses
+ *  open addressing with linear probing, so memory stays proportional to the
+ *  number of stored edges instead of the square of the number of vertices.
+ */
+typedef struct edge_table {
+	long long * keys;
+	int * values;
+	int capacity;
+	int size;
+} edge_table, *Pedge_table;
+
+/**
+ * This function returns the key of an undirected edge, the same for (i,j) and
+ * (j,i), ordered first by the smaller vertex then by the larger one.
+ * @param  i The first vertex of the edge.
+ * @param  j The second vertex of the edge.
+ * @return   The key of the edge.
+ */
+long long edge_key(int i, int j);
+
+/**
+ * This function returns a new empty edge table.
+ * @param  capacity The number of edges we expect to store.
+ * @return          A new edge table.
+ */
+Pedge_table new_edge_table(int capacity);
+
+/**
+ * This function returns the value associated to an edge.
+ * @param  t The edge table.
+ * @param  i The first vertex of the edge.
+ * @param  j The second vertex of the edge.
+ * @return   The value of (i,j) or -1 if (i,j) is not in the table.
+ */
+int edge_table_get(Pedge_table t, int i, int j);
+
+/**
+ * This function associates a value to an edge, replacing the previous one.
+ * @param t     The edge table.
+ * @param i     The first vertex of the edge.
+ * @param j     The second vertex of the edge.
+ * @param value The value, it must be positive or null.
+ */
+void edge_table_put(Pedge_table t, int i, int j, int value);
+
+/**
+ * This function removes an edge from the table.
+ * @param  t The edge table.
+ * @param  i The first vertex of the edge.
+ * @param  j The second vertex of the edge.
+ * @return   The value the edge had or -1 if (i,j) was not in the table.
+ */
+int edge_table_remove(Pedge_table t, int i, int j);
+
+/**
+ * This function removes all the edges of the table.
+ * @param  t The edge table.
+ * @return   The cleaned table.
+ */
+Pedge_table clean_edge_table(Pedge_table t);
+
+/**
+ * This function frees an edge table allocated in the heap.
+ * @param  t The edge table.
+ * @return   A null pointer.
+ */
+Pedge_table free_edge_table(Pedge_table t);
+
+#endif
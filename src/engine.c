@@ -0,0 +1,122 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "include.h"
+#include "engine.h"
+#include "heuristic.h"
+#include "local_search.h"
+#include "constructive.h"
+
+/**
+ * \struct engine_entry
+ * \brief engine of the registry
+ */
+typedef struct engine_entry {
+	const char *name;
+	tree_engine build;
+} engine_entry;
+
+static Pspanning_tree MBVST_local(Pgraph g){
+	return MBVST_local_search(g,0);
+}
+
+static const engine_entry engines[] = {
+	{"mbvst", MBVST},
+	{"mbvst_fast", MBVST_fast},
+	{"mbvst_local", MBVST_local},
+	{"dfs", DFS_tree},
+	{"greedy", greedy_degree_tree},
+	{"hamiltonian", hamiltonian_path_tree}
+};
+
+int engines_number(void){
+	return (int)(sizeof(engines)/sizeof(engines[0]));
+}
+
+const char* engine_name(int k){
+	if (k < 0 || k >= engines_number()){
+		return NULL;
+	}
+
+	return engines[k].name;
+}
+
+tree_engine get_engine(const char *name){
+	int k;
+
+	for (k = 0; k < engines_number(); k++){
+		if (strcmp(engines[k].name,name) == 0){
+			return engines[k].build;
+		}
+	}
+
+	return NULL;
+}
+
+int benchmark_engines(FILE *out, Pgraph *graphs, int graphs_number, const char **names, int names_number){
+	int i,k,runs,branch_vertices,total_branch_vertices;
+	int run = 0;
+	long long edges;
+	double time,total_time;
+	const char *name;
+	tree_engine build;
+	Pspanning_tree tree;
+	clock_t start;
+
+	if (names == NULL){
+		names_number = engines_number();
+	}
+
+	for (k = 0; k < names_number; k++){
+		name = names == NULL ? engine_name(k) : names[k];
+		build = get_engine(name);
+		if (build == NULL){
+			fprintf(out,"%-12s : moteur inconnu\n",name);
+			continue;
+		}
+		run++;
+
+		total_branch_vertices = 0;
+		total_time = 0;
+		edges = 0;
+		for (i = 0; i < graphs_number; i++){
+			runs = 0;
+			start = clock();
+			do {
+				tree = build(graphs[i]);
+				branch_vertices = tree->branch_vertices_number;
+				free_spanning_tree(tree);
+				runs++;
+			} while (clock() - start < CLOCKS_PER_SEC / 100);
+			time = (double)(clock() - start) / CLOCKS_PER_SEC / runs;
+
+			fprintf(out,"%-12s n = %5d, m = %7d : branch vertices : %4d (%.6fs)\n",name,
+				graphs[i]->vertices_number,graphs[i]->edges_number,branch_vertices,time);
+			total_branch_vertices += branch_vertices;
+			total_time += time;
+			edges += graphs[i]->edges_number;
+		}
+
+		fprintf(out,"%-12s total : branch vertices : %5d (%.6fs, %.0f arêtes/s)\n\n",name,
+			total_branch_vertices,total_time,total_time > 0 ? edges / total_time : 0);
+	}
+
+	return run;
+}
@@ -0,0 +1,84 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+/** @file engine.h
+ *
+ * @brief This file manages the registry of the cover tree engines.
+ *
+ * Every heuristic building a spanning tree is an engine with a name, so a
+ * driver chooses it by name and the benchmark compares all of them :
+ *
+ * - mbvst : MBVST, the minimum cut heuristic ;
+ * - mbvst_fast : MBVST_fast, the Kruskal-like approximation of MBVST ;
+ * - mbvst_local : MBVST followed by the local search ;
+ * - dfs : DFS_tree ;
+ * - greedy : greedy_degree_tree ;
+ * - hamiltonian : hamiltonian_path_tree.
+ */
+
+#ifndef ENGINE__H
+#define ENGINE__H
+
+#include "include.h"
+#include "spanning_tree.h"
+
+/**
+ * An engine returns a spanning tree of a graph (a spanning forest if the
+ * graph is not connected).
+ */
+typedef Pspanning_tree (*tree_engine)(Pgraph g);
+
+/**
+ * This function returns the number of engines of the registry.
+ * @return The number of engines.
+ */
+int engines_number(void);
+
+/**
+ * This function returns the name of an engine of the registry.
+ * @param  k The number of the engine.
+ * @return   Its name, NULL if there is no engine k.
+ */
+const char* engine_name(int k);
+
+/**
+ * This function finds an engine by its name.
+ * @param  name The name.
+ * @return      The engine, NULL if there is none of that name.
+ */
+tree_engine get_engine(const char *name);
+
+/**
+ * This function runs engines over a set of graphs and prints, for every
+ * engine and every graph, the number of branch vertices of the tree and the
+ * time, then the total of the engine with its throughput in edges per
+ * second. A fast engine is run again until it has run for 10ms at least,
+ * so its time is the mean of the runs.
+ * @param  out           The output stream.
+ * @param  graphs        The graphs.
+ * @param  graphs_number The number of graphs.
+ * @param  names         The names of the engines, NULL for all of them.
+ * @param  names_number  The number of names.
+ * @return               The number of engines run, the unknown names are
+ *                       skipped.
+ */
+int benchmark_engines(FILE *out, Pgraph *graphs, int graphs_number, const char **names, int names_number);
+
+#endif
@@ -0,0 +1,464 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "include.h"
+#include "external_graph.h"
+#include "tools.h"
+#include "edge_table.h"
+
+/* number of edges buffered by each run during the merge */
+#define RUN_BUFFER_SIZE 512
+
+/**
+ * \struct union_find
+ * \brief disjoint sets of vertices, union by size
+ */
+typedef struct union_find {
+	int *parent;
+	int *size;
+	int n;
+} union_find;
+
+/**
+ * \struct sorted_run
+ * \brief a sorted run read back by chunks during the merge
+ */
+typedef struct sorted_run {
+	Pgraph_file file;
+	int edges[2*RUN_BUFFER_SIZE];
+	int position;
+	int count;
+} sorted_run;
+
+static int compare_keys(const void *a, const void *b){
+	long long x = *(const long long*)a;
+	long long y = *(const long long*)b;
+
+	return (x > y) - (x < y);
+}
+
+static int valid_edge(int n, int i, int j){
+	return i != j && i >= 0 && j >= 0 && i < n && j < n;
+}
+
+static void init_union_find(union_find *u, int n){
+	int v;
+
+	u->n = n;
+	u->parent = (int*)allocate((n+1)*sizeof(int));
+	u->size = (int*)allocate((n+1)*sizeof(int));
+	for (v = 0; v < n; v++){
+		u->parent[v] = v;
+		u->size[v] = 1;
+	}
+}
+
+static int find_root(union_find *u, int v){
+	while (u->parent[v] != v){
+		u->parent[v] = u->parent[u->parent[v]];
+		v = u->parent[v];
+	}
+	return v;
+}
+
+/* returns 1 if i and j were in two different sets */
+static int union_sets(union_find *u, int i, int j){
+	int a = find_root(u,i);
+	int b = find_root(u,j);
+	int t;
+
+	if (a == b){
+		return 0;
+	}
+	if (u->size[a] < u->size[b]){
+		t = a;
+		a = b;
+		b = t;
+	}
+	u->parent[b] = a;
+	u->size[a] += u->size[b];
+
+	return 1;
+}
+
+static void release_union_find(union_find *u){
+	free(u->parent);
+	free(u->size);
+}
+
+/* streams all the edges of a file into the union-find */
+static int union_file(union_find *u, Pgraph_file in, long long *non_forest){
+	int *buffer = (int*)allocate(2*EXTERNAL_BUFFER_SIZE*sizeof(int));
+	int read,k;
+
+	*non_forest = 0;
+	while ((read = read_edges(in,buffer,EXTERNAL_BUFFER_SIZE)) > 0){
+		for (k = 0; k < read; k++){
+			if (valid_edge(u->n,buffer[2*k],buffer[2*k+1]) && !union_sets(u,buffer[2*k],buffer[2*k+1])){
+				(*non_forest)++;
+			}
+		}
+	}
+
+	free(buffer);
+
+	return 1;
+}
+
+/* removes the runs first..last-1 */
+static void remove_runs(const char *output, int first, int last){
+	char path[1024];
+
+	for (; first < last; first++){
+		snprintf(path,sizeof(path),"%s.run%d",output,first);
+		remove(path);
+	}
+}
+
+/* returns 0 if the run can not be written, nothing is left on the disk */
+static int write_run(const char *output, int n, int runs, long long *chunk, int size){
+	char path[1024];
+	Pgraph_file w;
+	int k;
+
+	snprintf(path,sizeof(path),"%s.run%d",output,runs);
+	w = open_graph_writer(path,BINARY_FORMAT,n);
+	if (w == NULL){
+		return 0;
+	}
+
+	qsort(chunk,size,sizeof(long long),compare_keys);
+	for (k = 0; k < size; k++){
+		if (k == 0 || chunk[k] != chunk[k-1]){
+			write_edge(w,(int)(chunk[k] >> 32),(int)(chunk[k] & 0xffffffffLL));
+		}
+	}
+
+	if (close_graph_writer(w) == -1){
+		remove(path);
+		return 0;
+	}
+
+	return 1;
+}
+
+/* the key of the current edge of a run, -1 when the run is over */
+static long long run_key(sorted_run *run){
+	if (run->position == run->count){
+		run->count = read_edges(run->file,run->edges,RUN_BUFFER_SIZE);
+		run->position = 0;
+		if (run->count == 0){
+			return -1;
+		}
+	}
+
+	return edge_key(run->edges[2*run->position],run->edges[2*run->position+1]);
+}
+
+static void sift_down(long long *keys, int *heap, int size, int k){
+	int child,t;
+
+	while ((child = 2*k+1) < size){
+		if (child+1 < size && keys[heap[child+1]] < keys[heap[child]]){
+			child++;
+		}
+		if (keys[heap[k]] <= keys[heap[child]]){
+			return;
+		}
+		t = heap[k];
+		heap[k] = heap[child];
+		heap[child] = t;
+		k = child;
+	}
+}
+
+/* merges the runs first..first+count-1 into w, they are then removed.
+   Returns 0 if a run can not be read, the runs are then left as they are */
+static int merge_runs(const char *output, Pgraph_file w, int first, int count){
+	char path[1024];
+	sorted_run *run = (sorted_run*)allocate((count+1)*sizeof(sorted_run));
+	long long *keys = (long long*)allocate((count+1)*sizeof(long long));
+	int *heap = (int*)allocate((count+1)*sizeof(int));
+	int size = 0;
+	long long last = -1;
+	int k,top;
+
+	for (k = 0; k < count; k++){
+		snprintf(path,sizeof(path),"%s.run%d",output,first+k);
+		run[k].file = open_graph_reader(path);
+		if (run[k].file == NULL){
+			while (k-- > 0){
+				close_graph_reader(run[k].file);
+			}
+			free(run);
+			free(keys);
+			free(heap);
+			return 0;
+		}
+		run[k].position = 0;
+		run[k].count = 0;
+		keys[k] = run_key(&run[k]);
+		if (keys[k] != -1){
+			heap[size++] = k;
+		}
+	}
+	for (k = size/2; k >= 0; k--){
+		sift_down(keys,heap,size,k);
+	}
+
+	while (size > 0){
+		top = heap[0];
+		if (keys[top] != last){
+			last = keys[top];
+			write_edge(w,(int)(last >> 32),(int)(last & 0xffffffffLL));
+		}
+
+		run[top].position++;
+		keys[top] = run_key(&run[top]);
+		if (keys[top] == -1){
+			heap[0] = heap[--size];
+		}
+		sift_down(keys,heap,size,0);
+	}
+
+	for (k = 0; k < count; k++){
+		close_graph_reader(run[k].file);
+	}
+	remove_runs(output,first,first+count);
+
+	free(run);
+	free(keys);
+	free(heap);
+
+	return 1;
+}
+
+/* the oldest MERGE_FAN_IN runs are merged into a new run until few enough
+   are left for the last merge, so at most MERGE_FAN_IN files are open. On
+   an error, the runs and the partial output are removed */
+static long long merge_all_runs(const char *output, int format, int n, int runs){
+	char path[1024];
+	int first = 0;
+	int merged;
+	long long edges_number;
+	Pgraph_file w;
+
+	while (runs - first > MERGE_FAN_IN){
+		snprintf(path,sizeof(path),"%s.run%d",output,runs);
+		w = open_graph_writer(path,BINARY_FORMAT,n);
+		if (w == NULL){
+			remove_runs(output,first,runs);
+			return -1;
+		}
+		merged = merge_runs(output,w,first,MERGE_FAN_IN);
+		if (close_graph_writer(w) == -1 || !merged){
+			remove_runs(output,first,runs+1);
+			return -1;
+		}
+		first += MERGE_FAN_IN;
+		runs++;
+	}
+
+	w = open_graph_writer(output,format,n);
+	if (w == NULL){
+		remove_runs(output,first,runs);
+		return -1;
+	}
+	if (!merge_runs(output,w,first,runs-first)){
+		close_graph_writer(w);
+		remove(output);
+		remove_runs(output,first,runs);
+		return -1;
+	}
+
+	edges_number = close_graph_writer(w);
+	if (edges_number == -1){
+		remove(output);
+	}
+
+	return edges_number;
+}
+
+long long sort_graph_file(const char *input, const char *output, int format, int chunk_edges){
+	Pgraph_file in = open_graph_reader(input);
+	long long *chunk;
+	int *buffer;
+	int n,read,k,wanted;
+	int size = 0;
+	int runs = 0;
+
+	if (in == NULL || chunk_edges <= 0){
+		if (in != NULL){
+			close_graph_reader(in);
+		}
+		return -1;
+	}
+
+	n = in->vertices_number;
+	chunk = (long long*)allocate(chunk_edges*sizeof(long long));
+	buffer = (int*)allocate(2*EXTERNAL_BUFFER_SIZE*sizeof(int));
+
+	do {
+		wanted = chunk_edges - size < EXTERNAL_BUFFER_SIZE ? chunk_edges - size : EXTERNAL_BUFFER_SIZE;
+		read = read_edges(in,buffer,wanted);
+		for (k = 0; k < read; k++){
+			if (valid_edge(n,buffer[2*k],buffer[2*k+1])){
+				chunk[size++] = edge_key(buffer[2*k],buffer[2*k+1]);
+			}
+		}
+		if (size > 0 && (size == chunk_edges || read == 0)){
+			if (!write_run(output,n,runs,chunk,size)){
+				close_graph_reader(in);
+				free(chunk);
+				free(buffer);
+				remove_runs(output,0,runs);
+				return -1;
+			}
+			runs++;
+			size = 0;
+		}
+	} while (read > 0);
+
+	close_graph_reader(in);
+	free(chunk);
+	free(buffer);
+
+	return merge_all_runs(output,format,n,runs);
+}
+
+int* external_components(const char *input, int *components_number){
+	Pgraph_file in = open_graph_reader(input);
+	union_find u;
+	long long non_forest;
+	int *component;
+	int v,root;
+
+	if (in == NULL){
+		return NULL;
+	}
+
+	init_union_find(&u,in->vertices_number);
+	union_file(&u,in,&non_forest);
+	close_graph_reader(in);
+
+	/* the sizes are not needed anymore, they become the labels of the roots */
+	component = (int*)allocate((u.n+1)*sizeof(int));
+	*components_number = 0;
+	for (v = 0; v < u.n; v++){
+		u.size[v] = -1;
+	}
+	for (v = 0; v < u.n; v++){
+		root = find_root(&u,v);
+		if (u.size[root] == -1){
+			u.size[root] = (*components_number)++;
+		}
+		component[v] = u.size[root];
+	}
+
+	release_union_find(&u);
+
+	return component;
+}
+
+long long repair_graph_file(const char *input, const char *output, int format, Prng r){
+	Pgraph_file in = open_graph_reader(input);
+	Pgraph_file out;
+	union_find u;
+	long long non_forest,needed,m;
+	int *representatives;
+	int *buffer;
+	int components_number = 0;
+	int read,k,v;
+
+	if (in == NULL){
+		return -1;
+	}
+
+	/********************************************************/
+	/* First pass : the components and the number of edges  */
+	/*          out of the spanning forest                  */
+	/********************************************************/
+
+	init_union_find(&u,in->vertices_number);
+	union_file(&u,in,&non_forest);
+
+	representatives = (int*)allocate((u.n+1)*sizeof(int));
+	for (v = 0; v < u.n; v++){
+		if (find_root(&u,v) == v){
+			representatives[components_number++] = v;
+		}
+	}
+	needed = components_number-1 < non_forest ? components_number-1 : non_forest;
+
+	/***********************************************************/
+	/* Second pass : the same forest, with a uniform selection */
+	/*    of the non forest edges to remove (algorithm S)      */
+	/***********************************************************/
+
+	out = open_graph_writer(output,format,u.n);
+	if (out == NULL){
+		close_graph_reader(in);
+		release_union_find(&u);
+		free(representatives);
+		return -1;
+	}
+
+	release_union_find(&u);
+	init_union_find(&u,in->vertices_number);
+	rewind_graph_reader(in);
+	buffer = (int*)allocate(2*EXTERNAL_BUFFER_SIZE*sizeof(int));
+
+	while ((read = read_edges(in,buffer,EXTERNAL_BUFFER_SIZE)) > 0){
+		for (k = 0; k < read; k++){
+			if (!valid_edge(u.n,buffer[2*k],buffer[2*k+1])){
+				continue;
+			}
+			if (!union_sets(&u,buffer[2*k],buffer[2*k+1])){
+				if (rng_double(r) * non_forest < needed){
+					needed--;
+					non_forest--;
+					continue;
+				}
+				non_forest--;
+			}
+			write_edge(out,buffer[2*k],buffer[2*k+1]);
+		}
+	}
+
+	/********************************************************/
+	/* Last step : link the components with a chain         */
+	/********************************************************/
+
+	for (k = 0; k < components_number-1; k++){
+		write_edge(out,representatives[k],representatives[k+1]);
+	}
+
+	close_graph_reader(in);
+	release_union_find(&u);
+	free(representatives);
+	free(buffer);
+
+	m = close_graph_writer(out);
+	if (m == -1){
+		remove(output);
+	}
+
+	return m;
+}
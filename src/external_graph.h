@@ -0,0 +1,86 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+/** @file external_graph.h
+ *
+ * @brief This file manages the graphs stored in files which do not fit in
+ * memory.
+ *
+ * Only O(n) integers are kept in memory, the edges are streamed from the
+ * graph files (see graph_io.h) by chunks.
+ */
+
+#ifndef EXTERNAL__GRAPH__H
+#define EXTERNAL__GRAPH__H
+
+#include "include.h"
+#include "graph_io.h"
+#include "rng.h"
+
+/* number of edges read at once by a pass over a file */
+#define EXTERNAL_BUFFER_SIZE 4096
+
+/* number of runs merged at once by sort_graph_file */
+#define MERGE_FAN_IN 16
+
+/**
+ * This function sorts the edges of a graph file and removes the loops and the
+ * duplicated edges, every edge (i,j) being written with i < j. The file is
+ * sorted by chunks written in temporary runs (output.run<k>), which are then
+ * merged MERGE_FAN_IN at a time, in several passes if there are more runs.
+ * @param  input       The path of the graph file.
+ * @param  output      The path of the sorted graph file.
+ * @param  format      The format of the sorted file.
+ * @param  chunk_edges The number of edges sorted in memory at once.
+ * @return             The number of edges of the sorted file, -1 if a file
+ *                     can not be read or written : the runs and the partial
+ *                     sorted file are then removed.
+ */
+long long sort_graph_file(const char *input, const char *output, int format, int chunk_edges);
+
+/**
+ * This function computes the connected components of a graph file with a
+ * semi-external union-find : O(n) memory and one pass over the edges.
+ * @param  input             The path of the graph file.
+ * @param  components_number The number of connected components.
+ * @return                   The component of each vertex (numbered from 0 in
+ *                           the order of their smallest vertex), NULL if the
+ *                           file can not be read.
+ */
+int* external_components(const char *input, int *components_number);
+
+/**
+ * This function makes a graph file connected without changing its number of
+ * edges, as repair_connectivity does in memory : the k connected components
+ * are linked by a chain of k-1 edges, and k-1 random edges which are not in
+ * the spanning forest found by the union-find are removed. Two passes are made
+ * over the edges. The input must not contain duplicated edges (see
+ * sort_graph_file).
+ * @param  input  The path of the graph file.
+ * @param  output The path of the repaired graph file.
+ * @param  format The format of the repaired file.
+ * @param  r      The random number generator.
+ * @return        The number of edges of the repaired file, -1 if a file can
+ *                not be read or written : the partial repaired file is then
+ *                removed.
+ */
+long long repair_graph_file(const char *input, const char *output, int format, Prng r);
+
+#endif
@@ -21,6 +21,8 @@ CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 #include "include.h"
 #include "graph.h"
 #include "tools.h"
+#include "dynamic_connectivity.h"
+#include "edge_sampler.h"
 
 int get_vertex_degree(Pgraph g, int vertex){
 	int** am = g->adjacency_matrix;
@@ -161,6 +163,12 @@ int find_min_weight_edges(int* selected_edges_list, int *weight_list, int size){
 
 void add_edge(Pgraph g, int i, int j){
 	int** am = g->adjacency_matrix;
+	if (g->connectivity && !am[i][j]){
+		connectivity_add_edge(g->connectivity,i,j);
+	}
+	if (g->sampler && !am[i][j]){
+		edge_sampler_add(g->sampler,i,j);
+	}
 	am[i][j] = 1;
 	am[j][i] = 1;
 	g->edges_number +=1;
@@ -168,6 +176,12 @@ void add_edge(Pgraph g, int i, int j){
 
 void remove_edge(Pgraph g, int i, int j){
 	int** am = g->adjacency_matrix;
+	if (g->connectivity && am[i][j]){
+		connectivity_remove_edge(g->connectivity,i,j);
+	}
+	if (g->sampler && am[i][j]){
+		edge_sampler_remove(g->sampler,i,j);
+	}
 	am[i][j] = 0;
 	am[j][i] = 0;
 	g->edges_number -= 1;
@@ -219,6 +233,8 @@ Pgraph new_graph(int n){
 	g->adjacency_matrix = m;
 	g->vertices_number = n;
 	g->edges_number = 0;
+	g->connectivity = NULL;
+	g->sampler = NULL;
 
 	return g;
 }
@@ -245,6 +261,15 @@ Pgraph fill_graph(Pgraph g, void *m, int connected){
 
 	g->edges_number = connected ? edges_number : edges_number/2;
 
+	if (g->connectivity){
+		detach_connectivity(g);
+		attach_connectivity(g);
+	}
+	if (g->sampler){
+		detach_edge_sampler(g);
+		attach_edge_sampler(g);
+	}
+
 	return g;
 }
 
@@ -284,17 +309,55 @@ Pgraph clean_graph(Pgraph g){
 
 	g->edges_number = 0;
 
+	if (g->connectivity){
+		clean_connectivity(g->connectivity);
+	}
+	if (g->sampler){
+		clean_edge_sampler(g->sampler);
+	}
+
 	return g;
 }
 
 
 Pgraph free_graph(Pgraph g){
+	detach_connectivity(g);
+	detach_edge_sampler(g);
 	free_matrix(g->adjacency_matrix,g->vertices_number);
 	free(g);
 
 	return g;
 }
 
+Pgraph attach_connectivity(Pgraph g){
+	int** am = g->adjacency_matrix;
+	int size = g->vertices_number;
+	int i,j;
+
+	if (g->connectivity){
+		return g;
+	}
+
+	g->connectivity = new_connectivity(size);
+
+	for (i = 0; i < size; i++){
+		for (j = i+1; j < size; j++){
+			if (am[i][j]){
+				connectivity_add_edge(g->connectivity,i,j);
+			}
+		}
+	}
+
+	return g;
+}
+
+Pgraph detach_connectivity(Pgraph g){
+	if (g->connectivity){
+		g->connectivity = free_connectivity(g->connectivity);
+	}
+
+	return g;
+}
 
 void print_graph(Pgraph g, int verbose){
 	print_matrix(g->adjacency_matrix,g->vertices_number);
@@ -314,4 +377,20 @@ void print_edges(Pgraph g){
 		printf("%d-%d\n",res[i][0],res[i][1]);
 	}
 	free_matrix(res,m);
-}
\ No newline at end of file
+}
+
+Pgraph attach_edge_sampler(Pgraph g){
+	if (!g->sampler){
+		g->sampler = new_edge_sampler(g);
+	}
+
+	return g;
+}
+
+Pgraph detach_edge_sampler(Pgraph g){
+	if (g->sampler){
+		g->sampler = free_edge_sampler(g->sampler);
+	}
+
+	return g;
+}
@@ -27,17 +27,23 @@ CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
 
+struct connectivity;
+struct edge_sampler;
+
 /**
  * \struct graphe
  * \brief graph structure
  *
  * \a A graph is given by his adjacency matrix, his number of vertices and
- *  edged here.
+ *  edged here. A dynamic connectivity structure and an edge sampler can be
+ *  attached to it, they are then kept up to date by add_edge and remove_edge.
  */
 typedef struct graph {
   int ** adjacency_matrix;
   int vertices_number;
   int edges_number;
+  struct connectivity * connectivity;
+  struct edge_sampler * sampler;
 } graph, *Pgraph;
 
 
@@ -198,6 +204,38 @@ Pgraph clean_graph(Pgraph g);
  */
 Pgraph free_graph(Pgraph g);
 
+/**
+ * This function attaches a dynamic connectivity structure to an undirected
+ * graph G, built from its current edges. Nothing is done if one is already
+ * attached.
+ * @param  g The graph G.
+ * @return   The graph.
+ */
+Pgraph attach_connectivity(Pgraph g);
+
+/**
+ * This function detaches and frees the dynamic connectivity structure of a
+ * graph G, if any.
+ * @param  g The graph G.
+ * @return   The graph.
+ */
+Pgraph detach_connectivity(Pgraph g);
+
+/**
+ * This function attaches an edge sampler to an undirected graph G, built
+ * from its current edges. Nothing is done if one is already attached.
+ * @param  g The graph G.
+ * @return   The graph.
+ */
+Pgraph attach_edge_sampler(Pgraph g);
+
+/**
+ * This function detaches and frees the edge sampler of a graph G, if any.
+ * @param  g The graph G.
+ * @return   The graph.
+ */
+Pgraph detach_edge_sampler(Pgraph g);
+
 /**
  * This function prints a graph
  * @param  g 		The graph we want to print.
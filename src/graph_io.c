@@ -0,0 +1,226 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "include.h"
+#include "graph_io.h"
+
+#define BINARY_MAGIC "MBVG"
+#define BINARY_VERSION 1
+/* offset of m in the binary header : magic, version, n */
+#define BINARY_EDGES_OFFSET 12
+/* the text header reserves a fixed width for m, patched on close */
+#define TEXT_HEADER "%d %20lld\n"
+#define IO_BUFFER_SIZE 4096
+
+static Pgraph_file new_graph_file(FILE *file, int format, int n, long long m){
+	Pgraph_file f = (graph_file*) malloc(sizeof(graph_file));
+
+	if (f == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	f->file = file;
+	f->format = format;
+	f->vertices_number = n;
+	f->edges_number = m;
+	f->edges_read = 0;
+
+	return f;
+}
+
+Pgraph_file open_graph_writer(const char *path, int format, int n){
+	FILE *file = fopen(path,"wb");
+	int version = BINARY_VERSION;
+	long long m = 0;
+
+	if (file == NULL){
+		return NULL;
+	}
+
+	if (format == BINARY_FORMAT){
+		fwrite(BINARY_MAGIC,1,4,file);
+		fwrite(&version,sizeof(int),1,file);
+		fwrite(&n,sizeof(int),1,file);
+		fwrite(&m,sizeof(long long),1,file);
+	}
+	else {
+		fprintf(file,TEXT_HEADER,n,m);
+	}
+
+	return new_graph_file(file,format,n,0);
+}
+
+void write_edge(Pgraph_file w, int i, int j){
+	int edge[2];
+
+	if (w->format == BINARY_FORMAT){
+		edge[0] = i;
+		edge[1] = j;
+		fwrite(edge,sizeof(int),2,w->file);
+	}
+	else {
+		fprintf(w->file,"%d %d\n",i,j);
+	}
+
+	w->edges_number++;
+}
+
+long long close_graph_writer(Pgraph_file w){
+	long long m = w->edges_number;
+	int error;
+
+	if (w->format == BINARY_FORMAT){
+		error = fseek(w->file,BINARY_EDGES_OFFSET,SEEK_SET) != 0;
+		error = error || fwrite(&m,sizeof(long long),1,w->file) != 1;
+	}
+	else {
+		error = fseek(w->file,0,SEEK_SET) != 0;
+		error = error || fprintf(w->file,TEXT_HEADER,w->vertices_number,m) < 0;
+	}
+
+	error = (fclose(w->file) != 0) || error;
+	free(w);
+
+	return error ? -1 : m;
+}
+
+Pgraph_file open_graph_reader(const char *path){
+	FILE *file = fopen(path,"rb");
+	char magic[4];
+	int version,n;
+	long long m;
+
+	if (file == NULL){
+		return NULL;
+	}
+
+	if (fread(magic,1,4,file) == 4 && memcmp(magic,BINARY_MAGIC,4) == 0){
+		if (fread(&version,sizeof(int),1,file) != 1 || version != BINARY_VERSION
+			|| fread(&n,sizeof(int),1,file) != 1 || fread(&m,sizeof(long long),1,file) != 1){
+			fclose(file);
+			return NULL;
+		}
+		return new_graph_file(file,BINARY_FORMAT,n,m);
+	}
+
+	rewind(file);
+	if (fscanf(file,"%d %lld",&n,&m) != 2){
+		fclose(file);
+		return NULL;
+	}
+
+	return new_graph_file(file,EDGE_LIST_FORMAT,n,m);
+}
+
+int read_edges(Pgraph_file r, int *edges, int size){
+	long long left = r->edges_number - r->edges_read;
+	int k;
+
+	if (size > left){
+		size = (int)left;
+	}
+
+	if (r->format == BINARY_FORMAT){
+		k = (int)fread(edges,2*sizeof(int),size,r->file);
+	}
+	else {
+		for (k = 0; k < size; k++){
+			if (fscanf(r->file,"%d %d",&edges[2*k],&edges[2*k+1]) != 2){
+				break;
+			}
+		}
+	}
+
+	r->edges_read += k;
+
+	return k;
+}
+
+void rewind_graph_reader(Pgraph_file r){
+	int n;
+	long long m;
+
+	if (r->format == BINARY_FORMAT){
+		fseek(r->file,BINARY_EDGES_OFFSET+sizeof(long long),SEEK_SET);
+	}
+	else {
+		rewind(r->file);
+		if (fscanf(r->file,"%d %lld",&n,&m) != 2){
+			r->edges_read = r->edges_number;
+			return;
+		}
+	}
+
+	r->edges_read = 0;
+}
+
+Pgraph_file close_graph_reader(Pgraph_file r){
+	fclose(r->file);
+	free(r);
+
+	return NULL;
+}
+
+int write_graph_file(Pgraph g, const char *path, int format){
+	Pgraph_file w = open_graph_writer(path,format,g->vertices_number);
+	int i,j;
+
+	if (w == NULL){
+		return 0;
+	}
+
+	for (i = 0; i < g->vertices_number; i++){
+		for (j = i+1; j < g->vertices_number; j++){
+			if (g->adjacency_matrix[i][j] == 1){
+				write_edge(w,i,j);
+			}
+		}
+	}
+
+	return close_graph_writer(w) >= 0;
+}
+
+Pgraph read_graph_file(const char *path){
+	Pgraph_file r = open_graph_reader(path);
+	Pgraph g;
+	int edges[2*IO_BUFFER_SIZE];
+	int read,k,i,j;
+
+	if (r == NULL){
+		return NULL;
+	}
+
+	g = new_graph(r->vertices_number);
+
+	while ((read = read_edges(r,edges,IO_BUFFER_SIZE)) > 0){
+		for (k = 0; k < read; k++){
+			i = edges[2*k];
+			j = edges[2*k+1];
+			if (i != j && i >= 0 && j >= 0 && i < g->vertices_number && j < g->vertices_number
+				&& g->adjacency_matrix[i][j] == 0){
+				add_edge(g,i,j);
+			}
+		}
+	}
+
+	close_graph_reader(r);
+
+	return g;
+}
@@ -0,0 +1,129 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+/** @file graph_io.h
+ *
+ * @brief This file manages the graph files.
+ *
+ * Two formats are available. The edge list format is a text file whose first
+ * line is "n m" followed by one "i j" line per edge. The binary format is the
+ * magic "MBVG", a version (int32), n (int32), m (int64) and then the m edges
+ * as pairs of int32. Edges are written one at a time and m is written when
+ * the file is closed, so a file never has to be held in memory.
+ */
+
+#ifndef GRAPH__IO__H
+#define GRAPH__IO__H
+
+#include "include.h"
+#include "graph.h"
+
+#define EDGE_LIST_FORMAT 0
+#define BINARY_FORMAT 1
+
+/**
+ * \struct graph_file
+ * \brief graph file structure
+ *
+ * \a A graph file is opened either to write or to read edges, in one of the
+ *  two formats.
+ */
+typedef struct graph_file {
+	FILE * file;
+	int format;
+	int vertices_number;
+	long long edges_number;
+	long long edges_read;
+} graph_file, *Pgraph_file;
+
+/**
+ * This function creates a graph file and writes its header.
+ * @param  path   The path of the file.
+ * @param  format EDGE_LIST_FORMAT or BINARY_FORMAT.
+ * @param  n      The number of vertices.
+ * @return        The opened file, or NULL if it can not be created.
+ */
+Pgraph_file open_graph_writer(const char *path, int format, int n);
+
+/**
+ * This function writes an edge to a graph file.
+ * @param w The graph file.
+ * @param i The first vertex of the edge.
+ * @param j The second vertex of the edge.
+ */
+void write_edge(Pgraph_file w, int i, int j);
+
+/**
+ * This function writes the number of edges in the header and closes a graph
+ * file opened by open_graph_writer.
+ * @param  w The graph file.
+ * @return   The number of edges written, or -1 if an error occurred.
+ */
+long long close_graph_writer(Pgraph_file w);
+
+/**
+ * This function opens a graph file and reads its header. The format is
+ * recognized from the first bytes.
+ * @param  path The path of the file.
+ * @return      The opened file, or NULL if it can not be read.
+ */
+Pgraph_file open_graph_reader(const char *path);
+
+/**
+ * This function reads the next edges of a graph file.
+ * @param  r      The graph file.
+ * @param  edges  The buffer, edges[2k] and edges[2k+1] are the vertices of
+ *                the k-th edge read.
+ * @param  size   The maximum number of edges to read.
+ * @return        The number of edges read, 0 at the end of the file.
+ */
+int read_edges(Pgraph_file r, int *edges, int size);
+
+/**
+ * This function moves back to the first edge of a graph file.
+ * @param r The graph file.
+ */
+void rewind_graph_reader(Pgraph_file r);
+
+/**
+ * This function closes a graph file opened by open_graph_reader.
+ * @param  r The graph file.
+ * @return   A null pointer.
+ */
+Pgraph_file close_graph_reader(Pgraph_file r);
+
+/**
+ * This function writes an undirected graph to a file.
+ * @param  g      The graph G.
+ * @param  path   The path of the file.
+ * @param  format EDGE_LIST_FORMAT or BINARY_FORMAT.
+ * @return        1 if success, 0 otherwise.
+ */
+int write_graph_file(Pgraph g, const char *path, int format);
+
+/**
+ * This function reads a graph file into a new graph. Loops and duplicated
+ * edges are ignored.
+ * @param  path The path of the file.
+ * @return      The graph, or NULL if the file can not be read.
+ */
+Pgraph read_graph_file(const char *path);
+
+#endif
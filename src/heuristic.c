@@ -23,85 +23,40 @@ CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 #include "random_graph.h"
 #include "tools.h"
 #include "heuristic.h"
+#include "bgl_graph.h"
+#include "min_cut.h"
+#include "spanning_tree.h"
 #include <cassert>
 #include <cstddef>
 #include <cstdlib>
 #include <iostream>
-#include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/one_bit_color_map.hpp>
 #include <boost/graph/stoer_wagner_min_cut.hpp>
 #include <boost/property_map/property_map.hpp>
 #include <boost/typeof/typeof.hpp>
 
-struct edge_t
-{
-  unsigned long first;
-  unsigned long second;
-};
-
-void convert_edges_list(int **edges_list, int size, edge_t edges[]){
-  int i;
-
-  for (i = 0; i < size; i++)
-  {
-    edges[i].first = edges_list[i][0];
-    edges[i].second = edges_list[i][1];
-  }
-}
-
-
 int* run_stoer_wagner(int* weight_list, int size1, int **edges_list, int size2)
 {
   int i;
-  using namespace std;
 
   int* cut_list = (int *)calloc(size2,sizeof(int));
 
-  typedef boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS,
-  boost::no_property, boost::property<boost::edge_weight_t, int> > undirected_graph;
-
-  edge_t edge[size2];
-  convert_edges_list(edges_list,size2,edge);
-
-  undirected_graph g(edge, edge + size2, weight_list, size1, size2);
-
-  BOOST_AUTO(parities, boost::make_one_bit_color_map(num_vertices(g), get(boost::vertex_index, g)));
+  /* the lists are read in place, no adjacency_list is built */
+  Pbgl_graph g = new_bgl_graph(size1,edges_list,size2,weight_list);
 
-  // int w = boost::stoer_wagner_min_cut(g, get(boost::edge_weight, g), boost::parity_map(parities));
+  BOOST_AUTO(parities, boost::make_one_bit_color_map(boost::num_vertices(*g), get(boost::vertex_index, *g)));
 
-  boost::stoer_wagner_min_cut(g, get(boost::edge_weight, g), boost::parity_map(parities));
+  boost::stoer_wagner_min_cut(*g, get(boost::edge_weight, *g), boost::parity_map(parities));
 
   for (i = 0; i < size2; ++i)
   {
-    if (get(parities, edge[i].first) != get(parities, edge[i].second)){
+    if (get(parities, edges_list[i][0]) != get(parities, edges_list[i][1])){
       cut_list[i] = 1;
     }
   }
 
-  // cout << "The min-cut weight of G is " << w << ".\n" << endl;
-
-  // cout << "One set of vertices consists of:" << endl;
-  // size_t i;
-  // for (i = 0; i < num_vertices(g); ++i) {
-  //   if (get(parities, i))
-  //     cout << i << endl;
-  // }
-  // cout << endl;
-
-  // cout << "The other set of vertices consists of:" << endl;
-  // for (i = 0; i < num_vertices(g); ++i) {
-  //   if (!get(parities, i))
-  //     cout << i << endl;
-  // }
-  // cout << endl;
-
-  // cout << "Edges between two set of vertices" << endl;
-  // for (i = 0; i < num_vertices(g); ++i) {
-  //   if (!get(parities, i))
-  //     cout << i << endl;
-  // }
-  // cout << endl;
+  free_bgl_graph(g);
 
   return cut_list;
 }
@@ -120,41 +75,35 @@ int get_branch_vertex_number(Pgraph g){
   return res;
 }
 
+int get_branch_vertex_lower_bound(Pgraph g){
+  int i;
+  int res = 0;
+  int *vertices_type_list = get_vertices_type_list(g);
+
+  for (i = 0; i < g->vertices_number; i++){
+    if (vertices_type_list[i] == 3){
+      res++;
+    }
+  }
 
-void saturer(Pgraph g, Pgraph tree, int v, int *vertices_type_list, int *weight_list){
-  int i,w;
-  int size1 = g->edges_number;
-  int **edges_list_1 = get_edges_list(g);
+  free(vertices_type_list);
 
-  int size2 = tree->edges_number;
-  int **edges_list_2 = get_edges_list(tree);
+  return res;
+}
 
-  int **diff_edges_list = get_diff_edges_list(edges_list_1,size1,edges_list_2,size2);
-  int size = size1 - size2;
 
-  for (i = 0; i < size; i++){
-    if (diff_edges_list[i][0] == v){
-      v = diff_edges_list[i][0];
-      w = diff_edges_list[i][1];
-      // printf("On trouve arete %d-%d\n",v,w);
-      if (!connected_components_two_vertices(tree,v,w) && vertices_type_list[w] != 2){
-        add_edge(tree,v,w);
-        weight_list[find_edge(edges_list_1,size1,v,w)] = 1000;
-      }
-    }
-    else if(diff_edges_list[i][1] == v){
-      v = diff_edges_list[i][1];
-      w = diff_edges_list[i][0];
-      // printf("On trouve arete %d-%d\n",v,w);
-      if (!connected_components_two_vertices(tree,v,w) && vertices_type_list[w] != 2){
-        add_edge(tree,v,w);
-        weight_list[find_edge(edges_list_1,size1,v,w)] = 1000;
-      }
+void saturer(Pspanning_tree tree, int v, int *vertices_type_list, int *weight_list, int **edges_list, Pincidence in){
+  int k,e,w;
+
+  for (k = in->start[v]; k < in->start[v+1]; k++){
+    e = in->edges[k];
+    w = incidence_other_end(edges_list,e,v);
+    // printf("On trouve arete %d-%d\n",v,w);
+    if (!spanning_tree_connected(tree,v,w) && vertices_type_list[w] != 2){
+      spanning_tree_add_edge(tree,v,w);
+      weight_list[e] = 1000;
     }
   }
-  free_matrix(edges_list_1,size1);
-  free_matrix(edges_list_2,size2);
-  free_matrix(diff_edges_list,size);
 }
 
 
@@ -173,14 +122,14 @@ void get_first_edge(int *cut_list, int **edges_list, int size, int *x, int *y){
   }
 }
 
-void departager(Pgraph tree, int *cut_list, int **edges_list, int size, int *x, int *y){
+void departager(Pspanning_tree tree, int *cut_list, int **edges_list, int size, int *x, int *y){
   int i,u,v,deg_u,deg_v;
 
   for (i = 0; i < size; i++){
     u = edges_list[i][0];
     v = edges_list[i][1];
-    deg_u = get_vertex_degree(tree,u);
-    deg_v = get_vertex_degree(tree,v);
+    deg_u = tree->degree[u];
+    deg_v = tree->degree[v];
 
     // printf("u:%d v:%d deg_u:%d deg_v:%d\n",u,v,deg_u,deg_v);
 
@@ -195,77 +144,381 @@ void departager(Pgraph tree, int *cut_list, int **edges_list, int size, int *x,
   return ;
 }
 
-void changer_type(Pgraph g, Pgraph tree, int v, int *vertices_type_list, int *weight_list, int **edges_list, int size){
-  int deg_v = get_vertex_degree(tree,v);
+void changer_type(Pspanning_tree tree, int v, int *vertices_type_list, int *weight_list, int **edges_list, Pincidence in){
+  int deg_v = tree->degree[v];
 
   if (deg_v > 2){
     vertices_type_list[v] = 3;
-    modify_weight_list(v,weight_list,edges_list,size,-3);
-    saturer(g,tree,v,vertices_type_list,weight_list);
+    modify_incident_weight_list(v,weight_list,in,-3);
+    saturer(tree,v,vertices_type_list,weight_list,edges_list,in);
   }
 
 }
 
-Pgraph MBVST(Pgraph g){
-  int i,min,u,v;
-
+Pmbvst_workspace new_mbvst_workspace(Pgraph g){
+  int i;
   int size1 = g->vertices_number;
   int size2 = g->edges_number;
+  Pmbvst_workspace w = (mbvst_workspace *)malloc(sizeof(mbvst_workspace));
 
-  Pgraph tree = new_graph(size1);
+  if (w == NULL){
+    exit(EXIT_FAILURE);
+  }
 
-  int *weight_list = get_weight_list(g);
-  int *vertices_type_list = get_vertices_type_list(g);
-  int **edges_list = get_edges_list(g);
-  int *cut_list;
+  w->vertices_number = size1;
+  w->edges_number = size2;
+  w->tree = new_spanning_tree(size1);
+  w->weight_list = get_weight_list(g);
+  w->vertices_type_list = get_vertices_type_list(g);
+  w->edges_list = get_edges_list(g);
+  w->in = new_incidence(w->edges_list,size1,size2);
+  w->r = NULL;
+
+  w->side = (int *)malloc((size1+1)*sizeof(int));
+  w->cut_list = (int *)calloc(size2+1,sizeof(int));
+
+  if (w->side == NULL || w->cut_list == NULL){
+    exit(EXIT_FAILURE);
+  }
+
+  /* an edge outside T starts at 1, then each end adds 1 for the degrees 1,
+     2 and 3 in T and -3 once it branches, so it weighs 1 to 7 and the edges
+     outside T weigh less than 8 m in all. The whole graph is cut, the edges
+     of T included : the engine contracts them when its first cut is lighter
+     than them, and otherwise the larger keys share the last bucket, so the
+     iterations never allocate (see min_cut.h) */
+  w->cut = new_min_cut_workspace(size1,size2,8*size2);
 
   for (i = 0; i < size1; i++){
-    if (vertices_type_list[i] == 3){
+    if (w->vertices_type_list[i] == 3){
       // printf("On sature\n");
-      saturer(g,tree,i,vertices_type_list,weight_list);
+      saturer(w->tree,i,w->vertices_type_list,w->weight_list,w->edges_list,w->in);
+    }
+  }
+
+  return w;
+}
+
+/* a uniform edge of the cut, among the edges between two leaves of T when
+   there are some and leaves is set (the rule of departager) */
+static int pick_random_edge(Pmbvst_workspace w, int leaves, int *x, int *y){
+  int i,u,v;
+  int count = 0;
+
+  for (i = 0; i < w->edges_number; i++){
+    u = w->edges_list[i][0];
+    v = w->edges_list[i][1];
+
+    if (w->cut_list[i] && (!leaves || (w->tree->degree[u] == 1 && w->tree->degree[v] == 1))){
+      count++;
+      if (rng_uniform(w->r,count) == 0){
+        *x = u;
+        *y = v;
+      }
+    }
+  }
+
+  return count;
+}
+
+int mbvst_step(Pmbvst_workspace w){
+  int i,min;
+  int u = -1;
+  int v = -1;
+  int size2 = w->edges_number;
+  Pspanning_tree tree = w->tree;
+
+  if (tree->edges_number >= tree->vertices_number - 1){
+    return 0;
+  }
+
+  /* the whole graph is cut, as run_stoer_wagner did, so that the ties
+     between the minimum cuts are broken the same way */
+  workspace_min_cut(w->cut,w->weight_list,w->vertices_number,w->edges_list,size2,w->side);
+
+  for (i = 0; i < size2; i++){
+    w->cut_list[i] = w->side[w->edges_list[i][0]] != w->side[w->edges_list[i][1]];
+  }
+
+  min = find_min_weight_edges(w->cut_list,w->weight_list,size2);
+
+  if (w->r != NULL){
+    if (min != 3 || !pick_random_edge(w,1,&u,&v)){
+      pick_random_edge(w,0,&u,&v);
+    }
+  }
+  else if (min == 3){
+    departager(tree,w->cut_list,w->edges_list,size2,&u,&v);
+  }
+  else{
+    get_first_edge(w->cut_list,w->edges_list,size2,&u,&v);
+  }
+
+  /* no edge leaves the components : G is not connected */
+  if (u == -1){
+    return 0;
+  }
+
+  spanning_tree_add_edge(tree,u,v);
+
+  if (w->vertices_type_list[u] == 2){
+    modify_incident_weight_list(u,w->weight_list,w->in,1);
+    changer_type(tree,u,w->vertices_type_list,w->weight_list,w->edges_list,w->in);
+  }
+
+  if (w->vertices_type_list[v] == 2){
+    modify_incident_weight_list(v,w->weight_list,w->in,1);
+    changer_type(tree,v,w->vertices_type_list,w->weight_list,w->edges_list,w->in);
+  }
+
+  w->weight_list[incidence_find_edge(w->in,w->edges_list,u,v)] = 1000;
+
+  return 1;
+}
+
+Pmbvst_workspace free_mbvst_workspace(Pmbvst_workspace w){
+  free_min_cut_workspace(w->cut);
+  free(w->side);
+  free(w->cut_list);
+  free_incidence(w->in);
+  free_matrix(w->edges_list,w->edges_number);
+  free(w->weight_list);
+  free(w->vertices_type_list);
+  if (w->tree != NULL){
+    free_spanning_tree(w->tree);
+  }
+  free(w);
+
+  return NULL;
+}
+
+Pspanning_tree MBVST(Pgraph g){
+  Pmbvst_workspace w = new_mbvst_workspace(g);
+  Pspanning_tree tree;
+
+  while (mbvst_step(w));
+
+  /* the tree is kept, the workspace freed */
+  tree = w->tree;
+  w->tree = NULL;
+  free_mbvst_workspace(w);
+
+  return tree;
+}
+
+Pgraph MBVST_graph(Pgraph g){
+  Pspanning_tree t = MBVST(g);
+  Pgraph tree = spanning_tree_to_graph(t);
+
+  free_spanning_tree(t);
+
+  return tree;
+}
+
+/**
+ * \struct edge_entry
+ * \brief entry of the heap of MBVST_fast
+ */
+typedef struct edge_entry {
+  int weight;
+  int tie;
+  int index;
+} edge_entry;
+
+/**
+ * \struct edge_heap
+ * \brief binary heap of edge entries, the smallest on top
+ */
+typedef struct edge_heap {
+  edge_entry *entries;
+  int size;
+  int capacity;
+} edge_heap;
+
+/**
+ * \struct fast_tree
+ * \brief state of MBVST_fast
+ *
+ * \a The tree with the weights and types of MBVST.
+ */
+typedef struct fast_tree {
+  Pspanning_tree tree;
+  int **edges_list;
+  int *weight_list;
+  int *vertices_type_list;
+  Pincidence in;
+  edge_heap heap;
+} fast_tree;
+
+static int entry_less(edge_entry a, edge_entry b){
+  if (a.weight != b.weight){
+    return a.weight < b.weight;
+  }
+  if (a.tie != b.tie){
+    return a.tie < b.tie;
+  }
+  return a.index < b.index;
+}
+
+static void heap_push(edge_heap *h, edge_entry e){
+  int k,p;
+
+  if (h->size == h->capacity){
+    h->capacity = 2*h->capacity + 16;
+    h->entries = (edge_entry *)realloc(h->entries,h->capacity*sizeof(edge_entry));
+    if (h->entries == NULL){
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  k = h->size++;
+  while (k > 0){
+    p = (k-1)/2;
+    if (!entry_less(e,h->entries[p])){
+      break;
     }
+    h->entries[k] = h->entries[p];
+    k = p;
   }
+  h->entries[k] = e;
+}
+
+static edge_entry heap_pop(edge_heap *h){
+  int k,c;
+  edge_entry top = h->entries[0];
+  edge_entry last = h->entries[--h->size];
+
+  k = 0;
+  while ((c = 2*k+1) < h->size){
+    if (c+1 < h->size && entry_less(h->entries[c+1],h->entries[c])){
+      c++;
+    }
+    if (!entry_less(h->entries[c],last)){
+      break;
+    }
+    h->entries[k] = h->entries[c];
+    k = c;
+  }
+  h->entries[k] = last;
+
+  return top;
+}
 
-  int edges_number = tree->edges_number;
-  int vertices_number = tree->vertices_number;
+/* the key of departager : with weight 3, an edge between two leaves first */
+static edge_entry fast_entry(fast_tree *f, int i){
+  edge_entry e;
+  int u = f->edges_list[i][0];
+  int v = f->edges_list[i][1];
 
-  // print_array(vertices_type_list,size1);
-  // print_array(weight_list,size2);
-  // print_graph(tree,1);
+  e.weight = f->weight_list[i];
+  e.tie = !(e.weight == 3 && f->tree->degree[u] == 1 && f->tree->degree[v] == 1);
+  e.index = i;
 
-  while(edges_number < vertices_number - 1) {
+  return e;
+}
+
+static void fast_push_incident(fast_tree *f, int v){
+  int k,i;
+
+  for (k = f->in->start[v]; k < f->in->start[v+1]; k++){
+    i = f->in->edges[k];
+    if (!spanning_tree_connected(f->tree,f->edges_list[i][0],f->edges_list[i][1])){
+      heap_push(&f->heap,fast_entry(f,i));
+    }
+  }
+}
 
-    cut_list = run_stoer_wagner(weight_list,size1,edges_list,size2);
+static void fast_add_edge(fast_tree *f, int i){
+  int u = f->edges_list[i][0];
+  int v = f->edges_list[i][1];
 
-    min = find_min_weight_edges(cut_list,weight_list,size2);
+  spanning_tree_add_edge(f->tree,u,v);
+  f->weight_list[i] = 1000;
+}
 
-    if (min == 3){
-      departager(tree,cut_list,edges_list,size2,&u,&v);
+/* saturer on the incident edges of v */
+static void fast_saturate(fast_tree *f, int v, int push){
+  int k,i,w;
+
+  for (k = f->in->start[v]; k < f->in->start[v+1]; k++){
+    i = f->in->edges[k];
+    w = incidence_other_end(f->edges_list,i,v);
+    if (!spanning_tree_connected(f->tree,v,w) && f->vertices_type_list[w] != 2){
+      fast_add_edge(f,i);
+      if (push){
+        fast_push_incident(f,w);
+      }
     }
-    else{
-      get_first_edge(cut_list,edges_list,size2,&u,&v);
+  }
+}
+
+/* changer_type after the insertion of an edge at v */
+static void fast_change_type(fast_tree *f, int v){
+  if (f->vertices_type_list[v] == 2){
+    modify_incident_weight_list(v,f->weight_list,f->in,1);
+    if (f->tree->degree[v] > 2){
+      f->vertices_type_list[v] = 3;
+      modify_incident_weight_list(v,f->weight_list,f->in,-3);
+      fast_saturate(f,v,1);
     }
+  }
+}
 
-    add_edge(tree,u,v);
+Pspanning_tree MBVST_fast(Pgraph g){
+  int i,u,v;
+  int size1 = g->vertices_number;
+  int size2 = g->edges_number;
+  edge_entry e;
+  fast_tree f;
+
+  f.tree = new_spanning_tree(size1);
+  f.edges_list = get_edges_list(g);
+  f.weight_list = get_weight_list(g);
+  f.in = new_incidence(f.edges_list,size1,size2);
+  f.heap.entries = NULL;
+  f.heap.size = 0;
+  f.heap.capacity = 0;
+
+  f.vertices_type_list = get_vertices_type_list(g);
+
+  for (v = 0; v < size1; v++){
+    if (f.vertices_type_list[v] == 3){
+      fast_saturate(&f,v,0);
+    }
+  }
 
-    if (vertices_type_list[u] == 2){
-      modify_weight_list(u,weight_list,edges_list,size2,1);
-      changer_type(g,tree,u,vertices_type_list,weight_list,edges_list,size2);
+  for (i = 0; i < size2; i++){
+    if (!spanning_tree_connected(f.tree,f.edges_list[i][0],f.edges_list[i][1])){
+      heap_push(&f.heap,fast_entry(&f,i));
     }
+  }
+
+  /* every change of a key pushes a new entry, the outdated ones are skipped */
+  while (f.tree->edges_number < size1 - 1 && f.heap.size > 0){
+    e = heap_pop(&f.heap);
+    i = e.index;
+    u = f.edges_list[i][0];
+    v = f.edges_list[i][1];
 
-    if (vertices_type_list[v] == 2){
-      modify_weight_list(v,weight_list,edges_list,size2,1);
-      changer_type(g,tree,v,vertices_type_list,weight_list,edges_list,size2);
+    if (spanning_tree_connected(f.tree,u,v)){
+      continue;
+    }
+    if (entry_less(e,fast_entry(&f,i)) || entry_less(fast_entry(&f,i),e)){
+      continue;
     }
 
-    weight_list[find_edge(edges_list,size2,u,v)] = 1000;
-    free(cut_list);
-    edges_number = tree->edges_number;
+    fast_add_edge(&f,i);
+    fast_change_type(&f,u);
+    fast_change_type(&f,v);
+    fast_push_incident(&f,u);
+    fast_push_incident(&f,v);
   }
 
-  free_matrix(edges_list,size2);
-  free(weight_list);
-  free(vertices_type_list);
+  free_matrix(f.edges_list,size2);
+  free(f.weight_list);
+  free(f.vertices_type_list);
+  free_incidence(f.in);
+  free(f.heap.entries);
 
-  return tree;
-}
\ No newline at end of file
+  return f.tree;
+}
@@ -27,6 +27,35 @@ CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 #define HEURISTIC__H
 
 #include "include.h"
+#include "incidence.h"
+#include "spanning_tree.h"
+#include "min_cut.h"
+#include "rng.h"
+
+/**
+ * \struct mbvst_workspace
+ * \brief state and buffers of one MBVST solve
+ *
+ * \a The tree T, the lists of G and every buffer of an iteration of MBVST :
+ *  the minimum cut of the whole graph (cut) and its result (side, cut_list).
+ *  They are allocated once, by
+ *  new_mbvst_workspace, and an iteration only writes over them. If r is not
+ *  NULL, the ties between the edges of the cut are broken at random instead
+ *  of by the smallest index.
+ */
+typedef struct mbvst_workspace {
+  int vertices_number;
+  int edges_number;
+  Pspanning_tree tree;
+  int *weight_list;
+  int *vertices_type_list;
+  int **edges_list;
+  Pincidence in;
+  int *side;
+  int *cut_list;
+  Pmin_cut_workspace cut;
+  Prng r;
+} mbvst_workspace, *Pmbvst_workspace;
 
 /**
  * This function runs the stoer wagner algorithm.
@@ -47,14 +76,37 @@ int* run_stoer_wagner(int* weight_list, int size1, int **edges_list, int size2);
 int get_branch_vertex_number(Pgraph g);
 
 /**
- * This function achieve one step of the algorithm.
- * @param g                 The graph G.
+ * This function computes a lower bound of the number of branch vertices of
+ * the spanning trees of G : the vertices of type 3 (their removal leaves at
+ * least 3 components) have a degree of at least 3 in every spanning tree.
+ * @param  g The graph G.
+ * @return   The lower bound.
+ */
+int get_branch_vertex_lower_bound(Pgraph g);
+
+/**
+ * This function achieve one step of the algorithm : the edges of G incident
+ * to v are added to T when they join two components. It costs
+ * O(deg(v).alpha(n)) : the edges of T are rejected by the union-find of T
+ * like the other edges inside a component, so no edge list is built.
  * @param tree              The tree T.
  * @param v                 The vertex we want to saturate.
  * @param vertices_type_list The vertex type list.
  * @param weight_list       The weight list.
+ * @param edges_list        The list of the edges of G.
+ * @param in                The incident edges of edges_list.
  */
-void saturer(Pgraph g, Pgraph tree, int v, int *vertices_type_list, int *weight_list);
+void saturer(Pspanning_tree tree, int v, int *vertices_type_list, int *weight_list, int **edges_list, Pincidence in);
+
+/**
+ * This function selects the first edge of the cut.
+ * @param cut_list   The cut list.
+ * @param edges_list The list of the edges.
+ * @param size       The size of edges_list.
+ * @param x          The first vertex of the selected edge.
+ * @param y          The second vertex of the selected edge.
+ */
+void get_first_edge(int *cut_list, int **edges_list, int size, int *x, int *y);
 
 /**
  * This function achieves one step of the algorithm.
@@ -65,23 +117,67 @@ void saturer(Pgraph g, Pgraph tree, int v, int *vertices_type_list, int *weight_
  * @param x          The first vertex of the selected edge.
  * @param y          The second vertex of the selected edge.
  */
-void departager(Pgraph tree, int *cut_list, int **edges_list, int size, int *x, int *y);
+void departager(Pspanning_tree tree, int *cut_list, int **edges_list, int size, int *x, int *y);
 
 /**his function changes the type of  vertex.
- * @param g                 The graph G.
  * @param tree              The tree T.
  * @param v                 The vertex v.
  * @param vertices_type_list The list of vertices type.
  * @param weight_list       The weight list.
- * @param edges_list The list of the edges.
- * @param size              The size of the weight list.
+ * @param edges_list        The list of the edges of G.
+ * @param in                The incident edges of edges_list.
  */
-void changer_type(Pgraph g, Pgraph tree, int v, int *vertices_type_list, int *weight_list,int **edges_list, int size);
+void changer_type(Pspanning_tree tree, int v, int *vertices_type_list, int *weight_list, int **edges_list, Pincidence in);
+/**
+ * This function creates the workspace of a MBVST solve of graph G and
+ * saturates the vertices of type 3. The ties are broken by the smallest
+ * index until w->r is set.
+ * @param  g The graph G.
+ * @return   The workspace.
+ */
+Pmbvst_workspace new_mbvst_workspace(Pgraph g);
+
+/**
+ * This function achieves one iteration of MBVST : the edge chosen by the
+ * minimum cut is added to T, then the types and the weights change. It does
+ * not allocate any memory.
+ * @param  w The workspace.
+ * @return   0 if T was already a spanning tree (or a spanning forest of a
+ *           disconnected G), 1 otherwise.
+ */
+int mbvst_step(Pmbvst_workspace w);
+
+/**
+ * This function frees a MBVST workspace, and its tree unless it is NULL.
+ * @param  w The workspace.
+ * @return   A null pointer.
+ */
+Pmbvst_workspace free_mbvst_workspace(Pmbvst_workspace w);
+
 /**
  * This function applies the MBVST heuristic to graph G.
  * @param  g The graph G.
  * @return   The cover tree.
  */
-Pgraph MBVST(Pgraph g);
+Pspanning_tree MBVST(Pgraph g);
+
+/**
+ * This function applies the MBVST heuristic to graph G and returns the tree
+ * as a graph, for instance to be used as a block_solver.
+ * @param  g The graph G.
+ * @return   The cover tree.
+ */
+Pgraph MBVST_graph(Pgraph g);
+
+/**
+ * This function applies a fast approximation of the MBVST heuristic to graph
+ * G. Instead of a minimum cut, the cheapest edge between two components of
+ * the tree is chosen, like Kruskal : the edges are kept in a heap keyed by
+ * (weight, rule of departager, index) and the components in a union-find.
+ * The types and weights change as in MBVST. O(m log m) with the saturations.
+ * @param  g The graph G.
+ * @return   The cover tree.
+ */
+Pspanning_tree MBVST_fast(Pgraph g);
 
 #endif
@@ -0,0 +1,101 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "include.h"
+#include "incidence.h"
+
+Pincidence new_incidence(int **edges_list, int size1, int size2){
+	Pincidence in = new_empty_incidence(size1,size2);
+
+	fill_incidence(in,edges_list,size1,size2);
+
+	return in;
+}
+
+Pincidence new_empty_incidence(int size1, int size2){
+	Pincidence in = (incidence*) malloc(sizeof(incidence));
+
+	if (in == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	in->vertices_number = 0;
+	in->edges_number = 0;
+	in->start = (int*) calloc(size1+1,sizeof(int));
+	in->edges = (int*) malloc((2*size2+1)*sizeof(int));
+
+	if (in->start == NULL || in->edges == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	return in;
+}
+
+void fill_incidence(Pincidence in, int **edges_list, int size1, int size2){
+	int i,v;
+
+	in->vertices_number = size1;
+	in->edges_number = size2;
+
+	/* counting sort of the edge ends by vertex */
+	for (v = 0; v <= size1; v++){
+		in->start[v] = 0;
+	}
+	for (i = 0; i < size2; i++){
+		in->start[edges_list[i][0]+1]++;
+		in->start[edges_list[i][1]+1]++;
+	}
+	for (v = 0; v < size1; v++){
+		in->start[v+1] += in->start[v];
+	}
+	for (i = 0; i < size2; i++){
+		in->edges[in->start[edges_list[i][0]]++] = i;
+		in->edges[in->start[edges_list[i][1]]++] = i;
+	}
+	for (v = size1; v > 0; v--){
+		in->start[v] = in->start[v-1];
+	}
+	in->start[0] = 0;
+}
+
+int incidence_find_edge(Pincidence in, int **edges_list, int i, int j){
+	int k,e;
+
+	for (k = in->start[i]; k < in->start[i+1]; k++){
+		e = in->edges[k];
+		if (incidence_other_end(edges_list,e,i) == j){
+			return e;
+		}
+	}
+
+	return -1;
+}
+
+int incidence_other_end(int **edges_list, int e, int v){
+	return edges_list[e][0] == v ? edges_list[e][1] : edges_list[e][0];
+}
+
+Pincidence free_incidence(Pincidence in){
+	free(in->start);
+	free(in->edges);
+	free(in);
+
+	return NULL;
+}
@@ -0,0 +1,106 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+/** @file incidence.h
+ *
+ * @brief This file manages the incident edges of the vertices of an edge list.
+ *
+ * The ids of the edges incident to every vertex are stored in a single array,
+ * in increasing order, so the edges of a vertex v are visited in O(deg(v))
+ * instead of scanning the whole edge list.
+ */
+
+#ifndef INCIDENCE__H
+#define INCIDENCE__H
+
+#include "include.h"
+
+/**
+ * \struct incidence
+ * \brief incident edges structure
+ *
+ * \a The edges incident to vertex v are the ids
+ *  edges[start[v]] ... edges[start[v+1]-1] of the edge list.
+ */
+typedef struct incidence {
+	int vertices_number;
+	int edges_number;
+	int * start;
+	int * edges;
+} incidence, *Pincidence;
+
+/**
+ * This function computes the incident edges of every vertex of an edge list,
+ * with a counting sort in O(n+m).
+ * @param  edges_list The list of the edges.
+ * @param  size1      The number of vertices.
+ * @param  size2      The size of edges_list.
+ * @return            The incident edges.
+ */
+Pincidence new_incidence(int **edges_list, int size1, int size2);
+
+/**
+ * This function returns incident edges without any edge, with room for an
+ * edge list of at most size1 vertices and size2 edges (see fill_incidence).
+ * @param  size1 The largest number of vertices.
+ * @param  size2 The largest size of the edge lists.
+ * @return       The incident edges.
+ */
+Pincidence new_empty_incidence(int size1, int size2);
+
+/**
+ * This function computes again, in place, the incident edges of an edge
+ * list. Nothing is allocated, so in must have room for size1 vertices and
+ * size2 edges.
+ * @param in         The incident edges.
+ * @param edges_list The list of the edges.
+ * @param size1      The number of vertices.
+ * @param size2      The size of edges_list.
+ */
+void fill_incidence(Pincidence in, int **edges_list, int size1, int size2);
+
+/**
+ * This function returns the id of the edge between two vertices in
+ * O(deg(i)).
+ * @param  in         The incident edges of edges_list.
+ * @param  edges_list The list of the edges.
+ * @param  i          The first vertex.
+ * @param  j          The second vertex.
+ * @return            The id of the edge, -1 if there is none.
+ */
+int incidence_find_edge(Pincidence in, int **edges_list, int i, int j);
+
+/**
+ * This function returns the other end of an edge.
+ * @param  edges_list The list of the edges.
+ * @param  e          The id of the edge.
+ * @param  v          One end of the edge.
+ * @return            The other end.
+ */
+int incidence_other_end(int **edges_list, int e, int v);
+
+/**
+ * This function frees the incident edges.
+ * @param  in The incident edges.
+ * @return    A null pointer.
+ */
+Pincidence free_incidence(Pincidence in);
+
+#endif
@@ -0,0 +1,213 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "include.h"
+#include "instance_cache.h"
+#include "random_graph.h"
+#include "graph_io.h"
+#include "rng.h"
+#include "tools.h"
+
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <boost/thread/thread.hpp>
+#include <boost/atomic.hpp>
+#include <boost/bind/bind.hpp>
+
+/**
+ * \struct instance_batch
+ * \brief work shared by the threads of generate_instances
+ */
+typedef struct instance_batch {
+	const char *cache_dir;
+	int *sizes;
+	int *densities;
+	unsigned long long *seeds;
+	int number;
+	char *duplicate;
+	boost::atomic<int> next;
+	boost::atomic<int> generated;
+} instance_batch, *Pinstance_batch;
+
+/**
+ * \struct keyed_instance
+ * \brief the key of an instance of a batch and its index
+ */
+typedef struct keyed_instance {
+	unsigned long long key;
+	int index;
+} keyed_instance;
+
+unsigned long long instance_key(int size, int density, unsigned long long seed){
+	unsigned long long h = hash64(INSTANCE_GENERATOR_VERSION);
+
+	h = hash64(h ^ (unsigned long long)(unsigned int)size);
+	h = hash64(h ^ (unsigned long long)(unsigned int)density);
+	h = hash64(h ^ seed);
+
+	return h;
+}
+
+void instance_path(const char *cache_dir, int size, int density, unsigned long long seed, char *path){
+	snprintf(path,INSTANCE_PATH_LENGTH,"%s/%016llx.mbvg",cache_dir,instance_key(size,density,seed));
+}
+
+static int file_exists(const char *path){
+	struct stat s;
+
+	return stat(path,&s) == 0;
+}
+
+/* the file is written aside then renamed, a reader never sees half a file */
+static int store_instance(Pgraph g, const char *path){
+	char tmp_path[INSTANCE_PATH_LENGTH+64];
+
+	snprintf(tmp_path,sizeof(tmp_path),"%s.%ld.%p.tmp",path,(long)getpid(),(void*)g);
+	if (write_graph_file(g,tmp_path,BINARY_FORMAT) && rename(tmp_path,path) == 0){
+		return 1;
+	}
+	remove(tmp_path);
+
+	return 0;
+}
+
+/* stored is set to 1 when the graph was generated and written by this call */
+static Pgraph fetch_instance(const char *cache_dir, int size, int density, unsigned long long seed, int *stored){
+	char path[INSTANCE_PATH_LENGTH];
+	Pgraph g;
+	rng r;
+
+	*stored = 0;
+	instance_path(cache_dir,size,density,seed,path);
+
+	g = read_graph_file(path);
+	if (g != NULL){
+		if (g->vertices_number == size && g->edges_number == density){
+			return g;
+		}
+		free_graph(g);
+	}
+
+	/* the stream only depends on the instance */
+	init_rng(&r,seed,((unsigned long long)(unsigned int)size << 32) | (unsigned int)density);
+	g = generate_random_connected_graph(size,density,&r);
+	if (g == NULL){
+		return NULL;
+	}
+
+	if (mkdir(cache_dir,0755) == 0 || errno == EEXIST){
+		*stored = store_instance(g,path);
+	}
+
+	return g;
+}
+
+Pgraph load_instance(const char *cache_dir, int size, int density, unsigned long long seed){
+	int stored;
+
+	return fetch_instance(cache_dir,size,density,seed,&stored);
+}
+
+static int compare_instances(const void *a, const void *b){
+	const keyed_instance *x = (const keyed_instance*)a;
+	const keyed_instance *y = (const keyed_instance*)b;
+
+	if (x->key != y->key){
+		return x->key < y->key ? -1 : 1;
+	}
+
+	return (x->index > y->index) - (x->index < y->index);
+}
+
+/* an instance is a duplicate if an earlier instance of the batch has its key,
+   so each key is generated by one worker only */
+static char* find_duplicates(int *sizes, int *densities, unsigned long long *seeds, int number){
+	keyed_instance *keys = (keyed_instance*)allocate((number+1)*sizeof(keyed_instance));
+	char *duplicate = (char*)allocate((number+1)*sizeof(char));
+	int k;
+
+	for (k = 0; k < number; k++){
+		keys[k].key = instance_key(sizes[k],densities[k],seeds[k]);
+		keys[k].index = k;
+	}
+	qsort(keys,number,sizeof(keyed_instance),compare_instances);
+
+	for (k = 0; k < number; k++){
+		duplicate[keys[k].index] = k > 0 && keys[k].key == keys[k-1].key;
+	}
+	free(keys);
+
+	return duplicate;
+}
+
+static void generate_instances_worker(Pinstance_batch b){
+	char path[INSTANCE_PATH_LENGTH];
+	Pgraph g;
+	int k, stored;
+
+	while ((k = b->next++) < b->number){
+		instance_path(b->cache_dir,b->sizes[k],b->densities[k],b->seeds[k],path);
+		if (b->duplicate[k] || file_exists(path)){
+			continue;
+		}
+
+		g = fetch_instance(b->cache_dir,b->sizes[k],b->densities[k],b->seeds[k],&stored);
+		if (g != NULL){
+			free_graph(g);
+		}
+		if (stored){
+			b->generated++;
+		}
+	}
+}
+
+int generate_instances(const char *cache_dir, int *sizes, int *densities, unsigned long long *seeds, int number, int threads){
+	instance_batch b;
+	boost::thread_group workers;
+	int t;
+
+	b.cache_dir = cache_dir;
+	b.sizes = sizes;
+	b.densities = densities;
+	b.seeds = seeds;
+	b.number = number;
+	b.next = 0;
+	b.generated = 0;
+	b.duplicate = find_duplicates(sizes,densities,seeds,number);
+
+	/* hardware_concurrency is 0 when the number of cores is unknown */
+	if (threads <= 0){
+		threads = boost::thread::hardware_concurrency();
+		threads = threads > 1 ? threads : 1;
+	}
+	if (threads > number){
+		threads = number;
+	}
+
+	for (t = 0; t < threads; t++){
+		workers.create_thread(boost::bind(generate_instances_worker,&b));
+	}
+	workers.join_all();
+	free(b.duplicate);
+
+	return b.generated;
+}
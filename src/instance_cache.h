@@ -0,0 +1,85 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+/** @file instance_cache.h
+ *
+ * @brief This file manages a cache of random connected graphs on disk.
+ *
+ * An instance is given by (size, density, seed). Its file, in the binary
+ * graph format, is named after a hash of these values and of the version of
+ * the generator, so that a new generator never reads old instances.
+ */
+
+#ifndef INSTANCE__CACHE__H
+#define INSTANCE__CACHE__H
+
+#include "include.h"
+#include "graph.h"
+
+/* to increase whenever generate_random_connected_graph changes its output */
+#define INSTANCE_GENERATOR_VERSION 1
+#define INSTANCE_PATH_LENGTH 1024
+
+/**
+ * This function returns the key of an instance in the cache.
+ * @param  size    The number of vertices.
+ * @param  density The number of edges.
+ * @param  seed    The seed of the instance.
+ * @return         The key of the instance.
+ */
+unsigned long long instance_key(int size, int density, unsigned long long seed);
+
+/**
+ * This function writes the path of the file of an instance.
+ * @param cache_dir The cache directory.
+ * @param size      The number of vertices.
+ * @param density   The number of edges.
+ * @param seed      The seed of the instance.
+ * @param path      The path, at least INSTANCE_PATH_LENGTH characters.
+ */
+void instance_path(const char *cache_dir, int size, int density, unsigned long long seed, char *path);
+
+/**
+ * This function returns a random connected graph, read from the cache if it is
+ * there, generated and stored in the cache otherwise. The graph only depends
+ * on (size, density, seed).
+ * @param  cache_dir The cache directory, created if needed.
+ * @param  size      The number of vertices.
+ * @param  density   The number of edges.
+ * @param  seed      The seed of the instance.
+ * @return           The graph, or NULL if the density can not be reached.
+ */
+Pgraph load_instance(const char *cache_dir, int size, int density, unsigned long long seed);
+
+/**
+ * This function stores in the cache the instances which are not already in it.
+ * The instances are generated in parallel, each one by a single thread even
+ * when it appears several times in the batch.
+ * @param  cache_dir The cache directory, created if needed.
+ * @param  sizes     The numbers of vertices.
+ * @param  densities The numbers of edges.
+ * @param  seeds     The seeds.
+ * @param  number    The number of instances.
+ * @param  threads   The number of threads, 0 for one per core.
+ * @return           The number of instances generated and written by this call.
+ */
+int generate_instances(const char *cache_dir, int *sizes, int *densities, unsigned long long *seeds, int number, int threads);
+
+#endif
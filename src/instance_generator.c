@@ -0,0 +1,426 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "include.h"
+#include "instance_generator.h"
+#include "tools.h"
+#include "edge_table.h"
+
+/* attempts before a Watts-Strogatz edge keeps its ring position */
+#define REWIRING_ATTEMPTS 64
+/* consecutive rejected pairs before a random regular graph restarts */
+#define REGULAR_ATTEMPTS 1000
+
+/* Fenwick tree over n weights, tree[1..n] */
+
+static void fenwick_add(int *tree, int n, int i, int value){
+	for (i++; i <= n; i += i & (-i)){
+		tree[i] += value;
+	}
+}
+
+/* returns the smallest i such that weight[0] + ... + weight[i] > target */
+static int fenwick_find(int *tree, int n, int target){
+	int position = 0;
+	int step = 1;
+
+	while (2*step <= n){
+		step *= 2;
+	}
+
+	for (; step > 0; step /= 2){
+		if (position + step <= n && tree[position+step] <= target){
+			position += step;
+			target -= tree[position];
+		}
+	}
+
+	return position;
+}
+
+long long generate_geometric_graph(Pgraph_file w, double radius, Prng r){
+	int n = w->vertices_number;
+	int cells,i,j,k,c,cx,cy,dx,dy;
+	double ddx,ddy;
+	double *x;
+	double *y;
+	int *cell;
+	int *cell_start;
+	int *order;
+	long long m = 0;
+
+	if (radius <= 0 || n <= 0){
+		return -1;
+	}
+
+	/* cells of side 1/cells >= radius, at most n cells */
+	cells = radius >= 1 ? 1 : (int)(1/radius);
+	while (cells > 1 && (long long)cells*cells > n){
+		cells--;
+	}
+
+	x = (double*)allocate(n*sizeof(double));
+	y = (double*)allocate(n*sizeof(double));
+	cell = (int*)allocate(n*sizeof(int));
+	cell_start = (int*)allocate((cells*cells+1)*sizeof(int));
+	order = (int*)allocate(n*sizeof(int));
+
+	for (i = 0; i < cells*cells+1; i++){
+		cell_start[i] = 0;
+	}
+
+	for (i = 0; i < n; i++){
+		x[i] = rng_double(r);
+		y[i] = rng_double(r);
+		cx = (int)(x[i]*cells);
+		cy = (int)(y[i]*cells);
+		cell[i] = (cx < cells ? cx : cells-1) * cells + (cy < cells ? cy : cells-1);
+		cell_start[cell[i]+1]++;
+	}
+
+	/* counting sort of the points by cell */
+	for (c = 0; c < cells*cells; c++){
+		cell_start[c+1] += cell_start[c];
+	}
+	for (i = 0; i < n; i++){
+		order[cell_start[cell[i]]++] = i;
+	}
+	for (c = cells*cells; c > 0; c--){
+		cell_start[c] = cell_start[c-1];
+	}
+	cell_start[0] = 0;
+
+	for (i = 0; i < n; i++){
+		cx = cell[i] / cells;
+		cy = cell[i] % cells;
+		for (dx = -1; dx <= 1; dx++){
+			for (dy = -1; dy <= 1; dy++){
+				if (cx+dx < 0 || cx+dx >= cells || cy+dy < 0 || cy+dy >= cells){
+					continue;
+				}
+				c = (cx+dx)*cells + cy+dy;
+				for (k = cell_start[c]; k < cell_start[c+1]; k++){
+					j = order[k];
+					ddx = x[i]-x[j];
+					ddy = y[i]-y[j];
+					if (j > i && ddx*ddx + ddy*ddy <= radius*radius){
+						write_edge(w,i,j);
+						m++;
+					}
+				}
+			}
+		}
+	}
+
+	free(x);
+	free(y);
+	free(cell);
+	free(cell_start);
+	free(order);
+
+	return m;
+}
+
+long long generate_barabasi_albert_graph(Pgraph_file w, int k, Prng r){
+	int n = w->vertices_number;
+	int *tree;
+	int *targets;
+	int total,u,v,t,s;
+	long long m = 0;
+
+	if (k < 1 || k >= n || (long long)n*k >= INT_MAX/2){
+		return -1;
+	}
+
+	tree = (int*)allocate((n+1)*sizeof(int));
+	targets = (int*)allocate(k*sizeof(int));
+
+	for (u = 0; u <= n; u++){
+		tree[u] = 0;
+	}
+
+	for (u = 0; u <= k; u++){
+		for (v = u+1; v <= k; v++){
+			write_edge(w,u,v);
+			m++;
+		}
+		fenwick_add(tree,n,u,k);
+	}
+
+	for (v = k+1; v < n; v++){
+		total = (int)(2*m);
+		for (t = 0; t < k; t++){
+			do {
+				u = fenwick_find(tree,n,rng_uniform(r,total));
+				for (s = 0; s < t && targets[s] != u; s++);
+			} while (s < t);
+			targets[t] = u;
+		}
+
+		for (t = 0; t < k; t++){
+			write_edge(w,targets[t],v);
+			fenwick_add(tree,n,targets[t],1);
+			m++;
+		}
+		fenwick_add(tree,n,v,k);
+	}
+
+	free(tree);
+	free(targets);
+
+	return m;
+}
+
+long long generate_watts_strogatz_graph(Pgraph_file w, int k, double beta, Prng r){
+	int n = w->vertices_number;
+	Pedge_table rewired;
+	int u,v,j,d,attempt;
+	long long m = 0;
+
+	if (k < 2 || k % 2 != 0 || k >= n-2 || beta < 0 || beta > 1){
+		return -1;
+	}
+
+	rewired = new_edge_table((int)(beta*n*(k/2)) + 1);
+
+	for (u = 0; u < n; u++){
+		for (j = 1; j <= k/2; j++){
+			v = (u+j) % n;
+			if (rng_double(r) < beta){
+				for (attempt = 0; attempt < REWIRING_ATTEMPTS; attempt++){
+					d = 1 + rng_uniform(r,n-1);
+					/* the ring distance of u and u+d must be > k/2 */
+					if (d > k/2 && d < n-k/2 && edge_table_get(rewired,u,(u+d) % n) == -1){
+						v = (u+d) % n;
+						edge_table_put(rewired,u,v,0);
+						break;
+					}
+				}
+			}
+			write_edge(w,u,v);
+			m++;
+		}
+	}
+
+	free_edge_table(rewired);
+
+	return m;
+}
+
+long long generate_grid_graph(Pgraph_file w, int rows, int columns, int torus){
+	int i,j;
+	long long m = 0;
+
+	if (rows < 1 || columns < 1 || (long long)rows*columns != w->vertices_number){
+		return -1;
+	}
+
+	for (i = 0; i < rows; i++){
+		for (j = 0; j < columns; j++){
+			if (j+1 < columns){
+				write_edge(w,i*columns+j,i*columns+j+1);
+				m++;
+			}
+			else if (torus && columns > 2){
+				write_edge(w,i*columns,i*columns+j);
+				m++;
+			}
+			if (i+1 < rows){
+				write_edge(w,i*columns+j,(i+1)*columns+j);
+				m++;
+			}
+			else if (torus && rows > 2){
+				write_edge(w,j,i*columns+j);
+				m++;
+			}
+		}
+	}
+
+	return m;
+}
+
+/* fills neighbours[u*d ...] with a random d-regular graph */
+static void build_regular_graph(int n, int d, Prng r, int *neighbours, int *degree, int *tree){
+	int total,failures,u,v,s;
+
+	do {
+		for (u = 0; u <= n; u++){
+			tree[u] = 0;
+		}
+		for (u = 0; u < n; u++){
+			degree[u] = 0;
+			fenwick_add(tree,n,u,d);
+		}
+
+		failures = 0;
+		total = n*d;
+		while (total > 0 && failures < REGULAR_ATTEMPTS){
+			u = fenwick_find(tree,n,rng_uniform(r,total));
+			v = fenwick_find(tree,n,rng_uniform(r,total));
+			for (s = 0; s < degree[u] && neighbours[u*d+s] != v; s++);
+			if (u == v || s < degree[u]){
+				failures++;
+				continue;
+			}
+			neighbours[u*d+degree[u]++] = v;
+			neighbours[v*d+degree[v]++] = u;
+			fenwick_add(tree,n,u,-1);
+			fenwick_add(tree,n,v,-1);
+			total -= 2;
+			failures = 0;
+		}
+	} while (total > 0);
+}
+
+long long generate_random_regular_graph(Pgraph_file w, int d, Prng r){
+	int n = w->vertices_number;
+	int *neighbours;
+	int *degree;
+	int *tree;
+	int *mark;
+	int complement,u,v,s;
+	long long m = 0;
+
+	if (d < 0 || d >= n || ((long long)n*d) % 2 != 0 || (long long)n*d >= INT_MAX){
+		return -1;
+	}
+
+	/* a dense regular graph is the complement of a sparse one */
+	complement = d > (n-1)/2;
+	if (complement){
+		d = n-1-d;
+	}
+
+	neighbours = (int*)allocate(((long long)n*d+1)*sizeof(int));
+	degree = (int*)allocate(n*sizeof(int));
+	tree = (int*)allocate((n+1)*sizeof(int));
+
+	build_regular_graph(n,d,r,neighbours,degree,tree);
+
+	if (!complement){
+		for (u = 0; u < n; u++){
+			for (s = 0; s < d; s++){
+				if (u < neighbours[u*d+s]){
+					write_edge(w,u,neighbours[u*d+s]);
+					m++;
+				}
+			}
+		}
+	}
+	else {
+		mark = (int*)allocate(n*sizeof(int));
+		for (u = 0; u < n; u++){
+			mark[u] = -1;
+		}
+		for (u = 0; u < n; u++){
+			for (s = 0; s < d; s++){
+				mark[neighbours[u*d+s]] = u;
+			}
+			for (v = u+1; v < n; v++){
+				if (mark[v] != u){
+					write_edge(w,u,v);
+					m++;
+				}
+			}
+		}
+		free(mark);
+	}
+
+	free(neighbours);
+	free(degree);
+	free(tree);
+
+	return m;
+}
+
+long long generate_planted_graph(Pgraph_file w, int branch_vertices, int density, Prng r){
+	int n = w->vertices_number;
+	int k = branch_vertices;
+	int path_length = n - 3*k;
+	long long noise = (long long)density - (n-1);
+	long long free_pairs = (long long)path_length*(path_length-1)/2 - (path_length-1);
+	int *order;
+	int *position;
+	int *hubs;
+	int i,j,u,v,t;
+	long long m = 0;
+	Pedge_table noise_edges;
+
+	if (n < 1 || k < 0 || path_length < (k > 0 ? k : 1) || noise < 0 || noise > free_pairs){
+		return -1;
+	}
+
+	/* a random labelling of the vertices : the path, then the leaves */
+	order = (int*)allocate(n*sizeof(int));
+	position = (int*)allocate(n*sizeof(int));
+	for (i = 0; i < n; i++){
+		order[i] = i;
+	}
+	for (i = n-1; i > 0; i--){
+		j = rng_uniform(r,i+1);
+		t = order[i];
+		order[i] = order[j];
+		order[j] = t;
+	}
+	for (i = 0; i < n; i++){
+		position[order[i]] = i;
+	}
+
+	for (i = 0; i+1 < path_length; i++){
+		write_edge(w,order[i],order[i+1]);
+		m++;
+	}
+
+	/* k distinct positions of the path are the hubs */
+	hubs = (int*)allocate((path_length+1)*sizeof(int));
+	for (i = 0; i < path_length; i++){
+		hubs[i] = i;
+	}
+	for (i = 0; i < k; i++){
+		j = i + rng_uniform(r,path_length-i);
+		t = hubs[i];
+		hubs[i] = hubs[j];
+		hubs[j] = t;
+		for (t = 0; t < 3; t++){
+			write_edge(w,order[hubs[i]],order[path_length+3*i+t]);
+			m++;
+		}
+	}
+
+	noise_edges = new_edge_table((int)noise + 1);
+	while (noise > 0){
+		u = order[rng_uniform(r,path_length)];
+		v = order[rng_uniform(r,path_length)];
+		if (u == v || abs(position[u]-position[v]) == 1 || edge_table_get(noise_edges,u,v) != -1){
+			continue;
+		}
+		edge_table_put(noise_edges,u,v,0);
+		write_edge(w,u,v);
+		m++;
+		noise--;
+	}
+
+	free_edge_table(noise_edges);
+	free(order);
+	free(position);
+	free(hubs);
+
+	return m;
+}
@@ -0,0 +1,115 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+/** @file instance_generator.h
+ *
+ * @brief This file manages the generation of benchmark instances.
+ *
+ * Every generator writes its edges directly into a graph file opened by
+ * open_graph_writer, the number of vertices is the one of the file. No
+ * adjacency matrix is built : the working memory is O(n) (O(n*d) for the
+ * random regular graphs, O(n + beta*m) for the Watts-Strogatz graphs).
+ */
+
+#ifndef INSTANCE__GENERATOR__H
+#define INSTANCE__GENERATOR__H
+
+#include "include.h"
+#include "graph_io.h"
+#include "rng.h"
+
+/**
+ * This function generates a random geometric graph : n points are drawn in
+ * the unit square and two points are linked if their distance is at most
+ * radius. The points are bucketed in a grid of cells of side >= radius so
+ * that only the neighbouring cells are scanned.
+ * @param  w      The graph file.
+ * @param  radius The radius, in (0,1].
+ * @param  r      The random number generator.
+ * @return        The number of edges, or -1 if the parameters are invalid.
+ */
+long long generate_geometric_graph(Pgraph_file w, double radius, Prng r);
+
+/**
+ * This function generates a Barabási–Albert graph : it starts from a clique
+ * of k+1 vertices and every new vertex is linked to k distinct vertices
+ * chosen with a probability proportional to their degree (Fenwick tree).
+ * @param  w The graph file.
+ * @param  k The number of edges of each new vertex, 1 <= k < n.
+ * @param  r The random number generator.
+ * @return   The number of edges, or -1 if the parameters are invalid.
+ */
+long long generate_barabasi_albert_graph(Pgraph_file w, int k, Prng r);
+
+/**
+ * This function generates a Watts–Strogatz graph : every vertex of a ring is
+ * linked to its k/2 next vertices, then every such edge is rewired to a
+ * uniform vertex with probability beta. A rewired edge never goes to a vertex
+ * at ring distance <= k/2, nor duplicates another rewired edge.
+ * @param  w    The graph file.
+ * @param  k    The degree of the ring, even and 2 <= k < n-2.
+ * @param  beta The probability of rewiring, in [0,1].
+ * @param  r    The random number generator.
+ * @return      The number of edges, or -1 if the parameters are invalid.
+ */
+long long generate_watts_strogatz_graph(Pgraph_file w, int k, double beta, Prng r);
+
+/**
+ * This function generates a grid of rows x columns vertices, the vertex of
+ * row i and column j is i*columns + j.
+ * @param  w       The graph file, with rows*columns vertices.
+ * @param  rows    The number of rows.
+ * @param  columns The number of columns.
+ * @param  torus   1 to wrap the rows and the columns, 0 otherwise.
+ * @return         The number of edges, or -1 if the parameters are invalid.
+ */
+long long generate_grid_graph(Pgraph_file w, int rows, int columns, int torus);
+
+/**
+ * This function generates a uniform-like random d-regular graph : the edges
+ * are drawn between two vertices chosen proportionally to their residual
+ * degrees, and the generation restarts when it gets stuck.
+ * @param  w The graph file.
+ * @param  d The degree, d < n and n*d even.
+ * @param  r The random number generator.
+ * @return   The number of edges, or -1 if the parameters are invalid.
+ */
+long long generate_random_regular_graph(Pgraph_file w, int d, Prng r);
+
+/**
+ * This function generates a graph whose optimal spanning tree has exactly
+ * branch_vertices branch vertices. A random path goes through every vertex
+ * but 3*branch_vertices leaves, and branch_vertices hubs of the path get 3 of
+ * the leaves each (with no hub, the path is Hamiltonian). Every spanning tree
+ * contains the edges of the leaves, so the hubs are branch vertices, and the
+ * path with the leaves is a spanning tree whose only branch vertices are the
+ * hubs. Noise edges are then drawn between vertices which are not leaves
+ * until the graph has density edges.
+ * @param  w               The graph file.
+ * @param  branch_vertices The optimal number of branch vertices.
+ * @param  density         The number of edges, for instance
+ *                         compute_density_formula(n).
+ * @param  r               The random number generator.
+ * @return                 The number of edges, or -1 if the parameters are
+ *                         invalid.
+ */
+long long generate_planted_graph(Pgraph_file w, int branch_vertices, int density, Prng r);
+
+#endif
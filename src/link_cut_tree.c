@@ -0,0 +1,297 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "include.h"
+#include "link_cut_tree.h"
+
+#define LEFT(t,x) ((t)->child[2*(x)])
+#define RIGHT(t,x) ((t)->child[2*(x)+1])
+
+Plink_cut_tree new_link_cut_tree(int n){
+	int x;
+	Plink_cut_tree t = (link_cut_tree*) malloc(sizeof(link_cut_tree));
+
+	if (t == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	t->nodes_number = n;
+	t->child = (int*) malloc((2*n+1)*sizeof(int));
+	t->parent = (int*) malloc((n+1)*sizeof(int));
+	t->reversed = (char*) calloc(n+1,sizeof(char));
+	t->size = (int*) malloc((n+1)*sizeof(int));
+	t->value = (int*) malloc((n+1)*sizeof(int));
+	t->top = (int*) malloc((3*n+1)*sizeof(int));
+	t->stack = (int*) malloc((n+1)*sizeof(int));
+
+	if (t->child == NULL || t->parent == NULL || t->reversed == NULL || t->size == NULL
+		|| t->value == NULL || t->top == NULL || t->stack == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	for (x = 0; x < n; x++){
+		LEFT(t,x) = -1;
+		RIGHT(t,x) = -1;
+		t->parent[x] = -1;
+		t->size[x] = 1;
+		t->value[x] = -1;
+		t->top[3*x] = -1;
+		t->top[3*x+1] = -1;
+		t->top[3*x+2] = -1;
+	}
+
+	return t;
+}
+
+/* x is the root of its splay tree when it is not a child of its parent */
+static int is_splay_root(Plink_cut_tree t, int x){
+	int p = t->parent[x];
+
+	return p == -1 || (LEFT(t,p) != x && RIGHT(t,p) != x);
+}
+
+/* inserts node x in the three largest values top[0..2] */
+static void insert_top(Plink_cut_tree t, int *top, int x){
+	int k,y;
+
+	if (x == -1 || t->value[x] < 0){
+		return;
+	}
+
+	for (k = 0; k < 3; k++){
+		if (top[k] == -1 || t->value[x] > t->value[top[k]]
+			|| (t->value[x] == t->value[top[k]] && x < top[k])){
+			y = top[k];
+			top[k] = x;
+			x = y;
+			if (x == -1){
+				return;
+			}
+		}
+	}
+}
+
+static void pull(Plink_cut_tree t, int x){
+	int k;
+	int l = LEFT(t,x);
+	int r = RIGHT(t,x);
+	int *top = t->top + 3*x;
+
+	t->size[x] = 1 + (l != -1 ? t->size[l] : 0) + (r != -1 ? t->size[r] : 0);
+
+	top[0] = -1;
+	top[1] = -1;
+	top[2] = -1;
+	insert_top(t,top,x);
+	for (k = 0; k < 3; k++){
+		if (l != -1){
+			insert_top(t,top,t->top[3*l+k]);
+		}
+		if (r != -1){
+			insert_top(t,top,t->top[3*r+k]);
+		}
+	}
+}
+
+static void push(Plink_cut_tree t, int x){
+	int y;
+
+	if (t->reversed[x]){
+		y = LEFT(t,x);
+		LEFT(t,x) = RIGHT(t,x);
+		RIGHT(t,x) = y;
+		if (LEFT(t,x) != -1){
+			t->reversed[LEFT(t,x)] ^= 1;
+		}
+		if (RIGHT(t,x) != -1){
+			t->reversed[RIGHT(t,x)] ^= 1;
+		}
+		t->reversed[x] = 0;
+	}
+}
+
+static void rotate(Plink_cut_tree t, int x){
+	int p = t->parent[x];
+	int g = t->parent[p];
+	int side = RIGHT(t,p) == x;
+	int b = t->child[2*x+1-side];
+
+	if (!is_splay_root(t,p)){
+		t->child[2*g+(RIGHT(t,g) == p)] = x;
+	}
+	t->parent[x] = g;
+
+	t->child[2*p+side] = b;
+	if (b != -1){
+		t->parent[b] = p;
+	}
+
+	t->child[2*x+1-side] = p;
+	t->parent[p] = x;
+
+	pull(t,p);
+	pull(t,x);
+}
+
+static void splay(Plink_cut_tree t, int x){
+	int p,g;
+	int depth = 0;
+
+	/* the reversals are pushed from the root of the splay tree */
+	t->stack[depth++] = x;
+	for (p = x; !is_splay_root(t,p); p = t->parent[p]){
+		t->stack[depth++] = t->parent[p];
+	}
+	while (depth > 0){
+		push(t,t->stack[--depth]);
+	}
+
+	while (!is_splay_root(t,x)){
+		p = t->parent[x];
+		if (!is_splay_root(t,p)){
+			g = t->parent[p];
+			if ((LEFT(t,g) == p) == (LEFT(t,p) == x)){
+				rotate(t,p);
+			}
+			else{
+				rotate(t,x);
+			}
+		}
+		rotate(t,x);
+	}
+}
+
+/* the path from the root of the tree to x becomes the splay tree of x */
+static void access(Plink_cut_tree t, int x){
+	int y;
+	int last = -1;
+
+	for (y = x; y != -1; y = t->parent[y]){
+		splay(t,y);
+		RIGHT(t,y) = last;
+		pull(t,y);
+		last = y;
+	}
+	splay(t,x);
+}
+
+static void make_root(Plink_cut_tree t, int x){
+	access(t,x);
+	t->reversed[x] ^= 1;
+}
+
+static int find_root(Plink_cut_tree t, int x){
+	access(t,x);
+	push(t,x);
+	while (LEFT(t,x) != -1){
+		x = LEFT(t,x);
+		push(t,x);
+	}
+	splay(t,x);
+
+	return x;
+}
+
+void link_cut_tree_link(Plink_cut_tree t, int u, int v){
+	make_root(t,u);
+	t->parent[u] = v;
+}
+
+int link_cut_tree_cut(Plink_cut_tree t, int u, int v){
+	make_root(t,u);
+	access(t,v);
+
+	/* u and v are neighbours when u is alone before v on the path */
+	push(t,v);
+	if (LEFT(t,v) != u || t->size[u] != 1){
+		return 0;
+	}
+
+	LEFT(t,v) = -1;
+	t->parent[u] = -1;
+	pull(t,v);
+
+	return 1;
+}
+
+int link_cut_tree_connected(Plink_cut_tree t, int u, int v){
+	return u == v || find_root(t,u) == find_root(t,v);
+}
+
+void link_cut_tree_set_value(Plink_cut_tree t, int x, int value){
+	access(t,x);
+	t->value[x] = value;
+	pull(t,x);
+}
+
+int link_cut_tree_path_top(Plink_cut_tree t, int u, int v, int *top){
+	make_root(t,u);
+	access(t,v);
+
+	top[0] = t->top[3*v];
+	top[1] = t->top[3*v+1];
+	top[2] = t->top[3*v+2];
+
+	return t->size[v];
+}
+
+int link_cut_tree_path_node(Plink_cut_tree t, int u, int v, int k){
+	int x,l;
+
+	make_root(t,u);
+	access(t,v);
+
+	if (k < 0 || k >= t->size[v]){
+		return -1;
+	}
+
+	/* the k-th node of the splay tree of v in order */
+	x = v;
+	while (1){
+		push(t,x);
+		l = LEFT(t,x) != -1 ? t->size[LEFT(t,x)] : 0;
+		if (k < l){
+			x = LEFT(t,x);
+		}
+		else if (k == l){
+			break;
+		}
+		else{
+			k -= l+1;
+			x = RIGHT(t,x);
+		}
+	}
+	splay(t,x);
+
+	return x;
+}
+
+Plink_cut_tree free_link_cut_tree(Plink_cut_tree t){
+	free(t->child);
+	free(t->parent);
+	free(t->reversed);
+	free(t->size);
+	free(t->value);
+	free(t->top);
+	free(t->stack);
+	free(t);
+
+	return NULL;
+}
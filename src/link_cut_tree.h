@@ -0,0 +1,129 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+/** @file link_cut_tree.h
+ *
+ * @brief This file manages a link-cut tree.
+ *
+ * A forest of nodes where trees are linked and cut and where the path
+ * between two nodes is queried, each operation in O(log n) amortized. The
+ * paths are splay trees ordered along the path, with lazy reversal to change
+ * the root. Every node has a value (-1 if none) and the splay trees keep
+ * the three nodes of largest value of their subtree.
+ */
+
+#ifndef LINK__CUT__TREE__H
+#define LINK__CUT__TREE__H
+
+#include "include.h"
+
+/**
+ * \struct link_cut_tree
+ * \brief link-cut tree structure
+ *
+ * \a The splay tree of node x has children child[2x] (left, towards the
+ *  root of the path) and child[2x+1], parent is the splay parent or the path
+ *  parent of the root of a splay tree. top[3x] ... top[3x+2] are the nodes
+ *  of largest value of the splay subtree of x, -1 if there are fewer.
+ */
+typedef struct link_cut_tree {
+	int nodes_number;
+	int *child;
+	int *parent;
+	char *reversed;
+	int *size;
+	int *value;
+	int *top;
+	int *stack;
+} link_cut_tree, *Plink_cut_tree;
+
+/**
+ * This function returns a forest of n nodes without any edge and without
+ * any value.
+ * @param  n The number of nodes.
+ * @return   The forest.
+ */
+Plink_cut_tree new_link_cut_tree(int n);
+
+/**
+ * This function links two nodes of two different trees.
+ * @param t The forest.
+ * @param u The first node.
+ * @param v The second node.
+ */
+void link_cut_tree_link(Plink_cut_tree t, int u, int v);
+
+/**
+ * This function cuts the edge between two nodes.
+ * @param  t The forest.
+ * @param  u The first node.
+ * @param  v The second node.
+ * @return   1 if the edge was cut, 0 if u and v were not neighbours.
+ */
+int link_cut_tree_cut(Plink_cut_tree t, int u, int v);
+
+/**
+ * This function tests if two nodes are in the same tree.
+ * @param  t The forest.
+ * @param  u The first node.
+ * @param  v The second node.
+ * @return   1 if they are, 0 otherwise.
+ */
+int link_cut_tree_connected(Plink_cut_tree t, int u, int v);
+
+/**
+ * This function changes the value of a node.
+ * @param t     The forest.
+ * @param x     The node.
+ * @param value The value, positive or null, -1 for no value.
+ */
+void link_cut_tree_set_value(Plink_cut_tree t, int x, int value);
+
+/**
+ * This function finds the nodes of largest value on the path between two
+ * nodes of a tree, the ties are broken by the smallest node.
+ * @param  t   The forest.
+ * @param  u   The first node.
+ * @param  v   The second node.
+ * @param  top Filled with the three nodes of largest value, -1 if the path
+ *             has fewer nodes with a value.
+ * @return     The number of nodes of the path.
+ */
+int link_cut_tree_path_top(Plink_cut_tree t, int u, int v, int *top);
+
+/**
+ * This function returns the k-th node of the path between two nodes of a
+ * tree.
+ * @param  t The forest.
+ * @param  u The first node, the node 0.
+ * @param  v The last node.
+ * @param  k The position of the node.
+ * @return   The node, -1 if the path is shorter.
+ */
+int link_cut_tree_path_node(Plink_cut_tree t, int u, int v, int k);
+
+/**
+ * This function frees a link-cut tree.
+ * @param  t The forest.
+ * @return   A null pointer.
+ */
+Plink_cut_tree free_link_cut_tree(Plink_cut_tree t);
+
+#endif
@@ -0,0 +1,237 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "include.h"
+#include "local_search.h"
+#include "graph.h"
+#include "tools.h"
+#include "link_cut_tree.h"
+#include "incidence.h"
+#include "random_graph.h"
+#include "heuristic.h"
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+/**
+ * \struct swap_search
+ * \brief state of the local search
+ *
+ * \a The node of vertex v is v, the node of edge e is vertices_number + e.
+ *  slot[e] is the position of e in the edges of the tree, -1 if e is not in
+ *  the tree. A branch vertex costs branch_cost, each degree over 2 costs 1.
+ */
+typedef struct swap_search {
+	int vertices_number;
+	int edges_number;
+	int branch_cost;
+	int **edges_list;
+	Pincidence in;
+	int *slot;
+	Pspanning_tree tree;
+	Plink_cut_tree lct;
+} swap_search;
+
+/* the cost of one more edge at v */
+static int add_cost(swap_search *s, int v){
+	int d = s->tree->degree[v];
+
+	return d == 2 ? s->branch_cost + 1 : (d > 2 ? 1 : 0);
+}
+
+/* the gain of one edge less at v */
+static int remove_gain(swap_search *s, int v){
+	int d = s->tree->degree[v];
+
+	return d == 3 ? s->branch_cost + 1 : (d > 3 ? 1 : 0);
+}
+
+static void update_edge_value(swap_search *s, int e){
+	link_cut_tree_set_value(s->lct,s->vertices_number+e,remove_gain(s,s->edges_list[e][0]) + remove_gain(s,s->edges_list[e][1]));
+}
+
+/* the tree edges around v take the new degree of v */
+static void update_vertex(swap_search *s, int v){
+	int k,e;
+
+	for (k = s->in->start[v]; k < s->in->start[v+1]; k++){
+		e = s->in->edges[k];
+		if (s->slot[e] != -1){
+			update_edge_value(s,e);
+		}
+	}
+}
+
+/* the change of the objective of the best move adding e, 0 if none improves */
+static int best_move(swap_search *s, int e, int *removed){
+	int k,f,length;
+	int n = s->vertices_number;
+	int a = s->edges_list[e][0];
+	int b = s->edges_list[e][1];
+	int top[3];
+	int first,last,delta;
+	int best = 0;
+
+	if (!link_cut_tree_connected(s->lct,a,b)){
+		return 0;
+	}
+
+	/* the path is a, first, a2, ..., b2, last, b */
+	length = link_cut_tree_path_top(s->lct,a,b,top);
+	first = link_cut_tree_path_node(s->lct,a,b,1);
+	last = link_cut_tree_path_node(s->lct,a,b,length-2);
+
+	/* an edge inside the path : a and b gain one edge each */
+	for (k = 0; k < 3 && top[k] != -1; k++){
+		if (top[k] != first && top[k] != last){
+			delta = add_cost(s,a) + add_cost(s,b) - s->lct->value[top[k]];
+			if (delta < best){
+				best = delta;
+				*removed = top[k] - n;
+			}
+			break;
+		}
+	}
+
+	/* the first edge : a keeps its degree */
+	f = first - n;
+	delta = add_cost(s,b) - remove_gain(s,incidence_other_end(s->edges_list,f,a));
+	if (delta < best){
+		best = delta;
+		*removed = f;
+	}
+
+	/* the last edge : b keeps its degree */
+	f = last - n;
+	delta = add_cost(s,a) - remove_gain(s,incidence_other_end(s->edges_list,f,b));
+	if (delta < best){
+		best = delta;
+		*removed = f;
+	}
+
+	return best;
+}
+
+static void add_tree_degree(Pspanning_tree tree, int v, int d){
+	tree->branch_vertices_number -= tree->degree[v] > 2;
+	tree->degree[v] += d;
+	tree->branch_vertices_number += tree->degree[v] > 2;
+}
+
+/* e enters the tree in the slot of f */
+static void apply_move(swap_search *s, int e, int f){
+	int n = s->vertices_number;
+	int x = s->edges_list[f][0];
+	int y = s->edges_list[f][1];
+	int a = s->edges_list[e][0];
+	int b = s->edges_list[e][1];
+	int i = s->slot[f];
+
+	link_cut_tree_cut(s->lct,x,n+f);
+	link_cut_tree_cut(s->lct,n+f,y);
+	link_cut_tree_set_value(s->lct,n+f,-1);
+	link_cut_tree_link(s->lct,a,n+e);
+	link_cut_tree_link(s->lct,n+e,b);
+
+	s->slot[e] = i;
+	s->slot[f] = -1;
+	s->tree->edges[2*i] = a;
+	s->tree->edges[2*i+1] = b;
+
+	add_tree_degree(s->tree,x,-1);
+	add_tree_degree(s->tree,y,-1);
+	add_tree_degree(s->tree,a,1);
+	add_tree_degree(s->tree,b,1);
+
+	update_vertex(s,x);
+	update_vertex(s,y);
+	update_vertex(s,a);
+	update_vertex(s,b);
+}
+
+int local_search(Pgraph g, Pspanning_tree tree, double time_budget){
+	int i,e,f,improved;
+	int n = g->vertices_number;
+	int m = g->edges_number;
+	int moves = 0;
+	int evaluations = 0;
+	swap_search s;
+	boost::posix_time::ptime deadline = boost::posix_time::microsec_clock::universal_time()
+		+ boost::posix_time::microseconds((long long)(time_budget*1e6));
+
+	s.vertices_number = n;
+	s.edges_number = m;
+	s.branch_cost = 2*n+1;
+	s.edges_list = get_edges_list(g);
+	s.in = new_incidence(s.edges_list,n,m);
+	s.slot = (int*) malloc((m+1)*sizeof(int));
+	s.tree = tree;
+	s.lct = new_link_cut_tree(n+m);
+
+	if (s.slot == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	for (e = 0; e < m; e++){
+		s.slot[e] = -1;
+	}
+	for (i = 0; i < tree->edges_number; i++){
+		e = incidence_find_edge(s.in,s.edges_list,tree->edges[2*i],tree->edges[2*i+1]);
+		s.slot[e] = i;
+		link_cut_tree_link(s.lct,tree->edges[2*i],n+e);
+		link_cut_tree_link(s.lct,n+e,tree->edges[2*i+1]);
+		update_edge_value(&s,e);
+	}
+
+	/* passes over the edges outside the tree until none improves */
+	improved = 1;
+	while (improved){
+		improved = 0;
+		for (e = 0; e < m; e++){
+			if (s.slot[e] != -1){
+				continue;
+			}
+			if (time_budget > 0 && ++evaluations % 256 == 0
+				&& boost::posix_time::microsec_clock::universal_time() > deadline){
+				improved = 0;
+				break;
+			}
+			if (best_move(&s,e,&f) < 0){
+				apply_move(&s,e,f);
+				moves++;
+				improved = 1;
+			}
+		}
+	}
+
+	free_link_cut_tree(s.lct);
+	free(s.slot);
+	free_incidence(s.in);
+	free_matrix(s.edges_list,m);
+
+	return moves;
+}
+
+Pspanning_tree MBVST_local_search(Pgraph g, double time_budget){
+	Pspanning_tree tree = MBVST(g);
+
+	local_search(g,tree,time_budget);
+
+	return tree;
+}
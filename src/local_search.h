@@ -0,0 +1,60 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+/** @file local_search.h
+ *
+ * @brief This file manages the local search improving a cover tree.
+ *
+ * A move adds an edge (a,b) of G outside the tree and removes an edge of the
+ * path from a to b in the tree. The objective is lexicographic : first the
+ * number of branch vertices, then the excess degree, the sum of deg(v) - 2
+ * over the branch vertices, so that moves towards fewer branch vertices are
+ * taken too. The tree is a link-cut tree where every tree edge is a node
+ * valued by the gain of its removal, so the best move of (a,b) is found in
+ * O(log n).
+ */
+
+#ifndef LOCAL__SEARCH__H
+#define LOCAL__SEARCH__H
+
+#include "include.h"
+#include "spanning_tree.h"
+
+/**
+ * This function improves a cover tree of G by edge swaps until no move
+ * improves the objective or the time budget is spent.
+ * @param  g           The graph G.
+ * @param  tree        The tree, a spanning forest of G, changed in place.
+ * @param  time_budget The time budget in seconds, 0 for none.
+ * @return             The number of moves.
+ */
+int local_search(Pgraph g, Pspanning_tree tree, double time_budget);
+
+/**
+ * This function applies the MBVST heuristic to graph G, then the local
+ * search to its tree.
+ * @param  g           The graph G.
+ * @param  time_budget The time budget of the local search in seconds, 0 for
+ *                     none.
+ * @return             The cover tree.
+ */
+Pspanning_tree MBVST_local_search(Pgraph g, double time_budget);
+
+#endif
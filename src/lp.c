@@ -22,8 +22,10 @@ CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 #include "graph.h"
 #include "lp.h"
 #include "tools.h"
+#include "solve_cache.h"
 
-int run_lp(Pgraph g)
+/* solves the MIP, the edges of the optimal tree are added to tree if not NULL */
+static int solve_lp(Pgraph g, Pgraph tree)
 {
   int n               = get_vertices_number(g);
   int m               = get_edges_number(g);
@@ -242,7 +244,9 @@ int run_lp(Pgraph g)
     printf("Failed\n");
       // delete problem
     glp_delete_prob(lp);
-    return 1;
+    free_matrix(edges_list,m);
+    free_matrix(edges_list_2,m);
+    return -1;
   }
 
   for(i=1; i<=m; i++){
@@ -307,13 +311,69 @@ int run_lp(Pgraph g)
     }
   }
 
+  if (tree != NULL){
+    for (i = 0; i < m; i++){
+      if (x[i] != 0){
+        add_edge(tree,edges_list[i][0],edges_list[i][1]);
+      }
+    }
+  }
+
   // Pgraph gresult = new_graph(n);
   // fill_graph(gresult,res,0);
   // print_graph(gresult,0);
   // printf("RESULTAT : %d\n",result);
 
   // free_graph(gresult);
-  // free_matrix(edges_list,m);
-  // free_matrix(edges_list_2,m);
+  free_matrix(edges_list,m);
+  free_matrix(edges_list_2,m);
   return result;
-}
\ No newline at end of file
+}
+
+int run_lp(Pgraph g)
+{
+  int result = solve_lp(g,NULL);
+
+  return result == -1 ? 1 : result;
+}
+
+Pgraph run_lp_tree(Pgraph g)
+{
+  Pgraph tree = new_graph(g->vertices_number);
+
+  if (solve_lp(g,tree) == -1){
+    free_graph(tree);
+    return NULL;
+  }
+
+  return tree;
+}
+
+int cached_run_lp(const char *cache_dir, Pgraph g)
+{
+  solve_result result;
+  clock_t start;
+
+  if (load_solve_result(cache_dir,g,"lp","",&result)){
+    free_graph(result.tree);
+    return result.branch_vertices;
+  }
+
+  start = clock();
+  result.tree = new_graph(g->vertices_number);
+  result.branch_vertices = solve_lp(g,result.tree);
+  result.time = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  if (result.branch_vertices == -1){
+    free_graph(result.tree);
+    return 1;
+  }
+
+  /* an optimal solution : both bounds are reached */
+  result.lower_bound = result.branch_vertices;
+  result.upper_bound = result.branch_vertices;
+  store_solve_result(cache_dir,g,"lp","",&result);
+  free_graph(result.tree);
+
+  return result.branch_vertices;
+}
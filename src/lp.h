@@ -35,4 +35,20 @@ CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 int run_lp(Pgraph g);
 
+/**
+ * This function run GLPK on our problem and returns the optimal tree.
+ * @param  g       The graph G.
+ * @return The spanning tree, or NULL if GLPK failed.
+ */
+Pgraph run_lp_tree(Pgraph g);
+
+/**
+ * This function returns the result of run_lp, from the cache of results if G
+ * was already solved (see solve_cache.h).
+ * @param  cache_dir The cache directory.
+ * @param  g         The graph G.
+ * @return The number of branch vertices.
+ */
+int cached_run_lp(const char *cache_dir, Pgraph g);
+
 #endif
@@ -24,11 +24,24 @@ CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 #include "random_graph.h"
 #include "heuristic.h"
 #include "lp.h"
+#include "instance_cache.h"
+#include "block_decomposition.h"
+#include "solve_cache.h"
+#include "multi_start.h"
+#include "local_search.h"
+#include "anytime.h"
+#include "engine.h"
 
-int main()
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#define CACHE_DIR "instances"
+#define RESULT_CACHE_DIR "results"
+
+int main(int argc, char *argv[])
 {
 
-	srand(time(NULL));
+	/* a seed given on the command line makes the run reuse the cache */
+	unsigned long long seed = argc > 1 ? strtoull(argv[1],NULL,10) : (unsigned long long)time(NULL);
 
 	printf("\n##########################################################\n");
 	printf("########### 1. Génération de graphes aléatoires ##########\n");
@@ -63,16 +76,26 @@ int main()
 	printf(" ==> Voir la fonction generate_random_graph\n\n");
 
 	printf("QUESTION 5 :\n\n");
+	printf("Graine aléatoire : %llu\n",seed);
 
 	int tab_size[6] = {20,50,100,400,600,1000};
+	int tab_density[6];
+	unsigned long long tab_seed[6];
 	int i,density;
 	Pgraph graph_tab[6];
 
+	for (i = 0; i < 6; i++){
+		tab_density[i] = compute_density_formula(tab_size[i]);
+		tab_seed[i] = seed;
+	}
+
+	printf("Instances générées : %d\n",generate_instances(CACHE_DIR,tab_size,tab_density,tab_seed,6,0));
+
 	for (i = 0; i < 6; i++)
 	{
-		density = compute_density_formula(tab_size[i]);
+		density = tab_density[i];
 		printf("La densité d'un graphe de taille %d est : %d\n",tab_size[i],density);
-		Pgraph gr = generate_random_graph(tab_size[i],density,1);
+		Pgraph gr = load_instance(CACHE_DIR,tab_size[i],density,seed);
 		// print_graph(gr,1);
 		graph_tab[i] = gr;
 	}
@@ -83,13 +106,69 @@ int main()
 	printf("##########################################################\n\n");
 
 
+	solve_result result;
+	clock_t start;
+
 	for (i = 0; i < 6; i++){
-		Pgraph tree = MBVST(graph_tab[i]);
+		/* the time of the solve is kept in the cache */
+		cached_MBVST(RESULT_CACHE_DIR,graph_tab[i],&result);
+		Pgraph tree = result.tree;
+		printf("branch vertices : %d (%.3fs)\n",result.branch_vertices,result.time);
+
+		/* the local search starts from the tree of MBVST */
+		start = clock();
+		Pspanning_tree local_tree = graph_to_spanning_tree(tree);
+		int moves = local_search(graph_tab[i],local_tree,1.0);
+		printf("branch vertices (recherche locale) : %d, %d échanges (%.3fs)\n",
+			local_tree->branch_vertices_number,moves,(double)(clock() - start) / CLOCKS_PER_SEC);
+		free_spanning_tree(local_tree);
+		free_graph(tree);
 
-		printf("branch vertices : %d\n",get_branch_vertex_number(tree));
+		/* the best tree found in half a second */
+		budget_result anytime_result;
+		init_budget_result(&anytime_result,seed);
+		MBVST_with_budget(graph_tab[i],0.5,&anytime_result);
+		printf("branch vertices (budget de 0.5s) : %d, %d arbres (trouvé en %.3fs)\n",anytime_result.branch_vertices,
+			anytime_result.trees,anytime_result.time);
+		free_spanning_tree(anytime_result.tree);
+
+		start = clock();
+		Pspanning_tree fast_tree = MBVST_fast(graph_tab[i]);
+		printf("branch vertices (rapide) : %d (%.3fs)\n",fast_tree->branch_vertices_number,(double)(clock() - start) / CLOCKS_PER_SEC);
+		free_spanning_tree(fast_tree);
+
+		tree = solve_by_blocks(graph_tab[i],MBVST_graph,0);
+		printf("branch vertices (par blocs) : %d\n",get_branch_vertex_number(tree));
 		free_graph(tree);
 	}
 
+	/* every engine on the small instances, the fast ones on all of them */
+	const char *fast_engines[4] = {"mbvst_fast","dfs","greedy","hamiltonian"};
+
+	printf("\nComparaison des moteurs :\n\n");
+	benchmark_engines(stdout,graph_tab,3,NULL,0);
+	benchmark_engines(stdout,graph_tab,6,fast_engines,4);
+
+	/* quality against wall-clock time of the multi-start on the small
+	   instances, with more runs and more threads */
+	int runs,threads,runs_done;
+	boost::posix_time::ptime wall_start;
+
+	printf("\nMulti-départ (borne inférieure, K départs, threads) :\n");
+	for (i = 0; i < 3; i++){
+		printf("\ngraphe de taille %d, borne inférieure : %d\n",tab_size[i],get_branch_vertex_lower_bound(graph_tab[i]));
+		for (runs = 1; runs <= 16; runs *= 4){
+			for (threads = 1; threads <= 4; threads *= 2){
+				wall_start = boost::posix_time::microsec_clock::universal_time();
+				Pspanning_tree best_tree = MBVST_multi_start(graph_tab[i],runs,threads,seed,&runs_done);
+				printf("K = %2d, threads = %d : branch vertices : %d, %d départs (%.3fs)\n",runs,threads,
+					best_tree->branch_vertices_number,runs_done,
+					(boost::posix_time::microsec_clock::universal_time() - wall_start).total_microseconds() / 1e6);
+				free_spanning_tree(best_tree);
+			}
+		}
+	}
+
 	printf("\n##########################################################\n");
 	printf("################### 3.Résolution exacte ###################\n");
 	printf("##########################################################\n\n");
@@ -98,8 +177,13 @@ int main()
 	int res;
 
 	for (i = 0; i < 6; i++){
-		res = run_lp(graph_tab[i]);
+		res = cached_run_lp(RESULT_CACHE_DIR,graph_tab[i]);
 		printf("branch vertices : %d\n",res);
+
+		/* GLPK is not reentrant : one thread */
+		Pgraph tree = solve_by_blocks(graph_tab[i],run_lp_tree,1);
+		printf("branch vertices (par blocs) : %d\n",get_branch_vertex_number(tree));
+		free_graph(tree);
 	}
 
 
@@ -0,0 +1,527 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+#include "include.h"
+#include "min_cut.h"
+#include "incidence.h"
+#include "tools.h"
+
+#include <climits>
+
+/* the heap is 4-ary and ordered like boost::d_ary_heap_indirect : a vertex
+   only goes above a strictly smaller key, the first of the largest children
+   comes up, so the searches visit the vertices in the order of Boost */
+#define HEAP_ARITY 4
+
+/**
+ * \struct bucket_queue
+ * \brief max priority queue on bounded non negative integer keys
+ *
+ * \a Key k is stored in bucket k, every bucket is a doubly linked list of
+ *  vertices. The keys of at least last share bucket last. top is an upper
+ *  bound of the largest bucket used.
+ */
+typedef struct bucket_queue {
+	int *head;
+	int *next;
+	int *previous;
+	int *key;
+	char *queued;
+	int top;
+	int last;
+	int size;
+} bucket_queue;
+
+static int bucket_of(bucket_queue *q, int v){
+	return q->key[v] < q->last ? q->key[v] : q->last;
+}
+
+static void bucket_unlink(bucket_queue *q, int v){
+	int b = bucket_of(q,v);
+
+	if (q->previous[v] != -1){
+		q->next[q->previous[v]] = q->next[v];
+	}
+	else{
+		q->head[b] = q->next[v];
+	}
+	if (q->next[v] != -1){
+		q->previous[q->next[v]] = q->previous[v];
+	}
+}
+
+static void bucket_link(bucket_queue *q, int v){
+	int b = bucket_of(q,v);
+
+	q->previous[v] = -1;
+	q->next[v] = q->head[b];
+	if (q->head[b] != -1){
+		q->previous[q->head[b]] = v;
+	}
+	q->head[b] = v;
+	if (b > q->top){
+		q->top = b;
+	}
+}
+
+static void bucket_push(bucket_queue *q, int v, int key){
+	q->key[v] = key;
+	q->queued[v] = 1;
+	q->size++;
+	bucket_link(q,v);
+}
+
+static void bucket_add(bucket_queue *q, int v, int w){
+	bucket_unlink(q,v);
+	q->key[v] += w;
+	bucket_link(q,v);
+}
+
+static int bucket_pop(bucket_queue *q){
+	int v;
+
+	while (q->head[q->top] == -1){
+		q->top--;
+	}
+	v = q->head[q->top];
+	bucket_unlink(q,v);
+	q->queued[v] = 0;
+	q->size--;
+
+	return v;
+}
+
+/* the weight of a minimum cut, by the phases and merges of Stoer-Wagner on
+   the bucket queue. When the weights add up to more than the buckets, the
+   larger keys share the last bucket : the order of a phase is then only a
+   maximum adjacency order for the keys capped at last, which still finds
+   every cut lighter than last. The result is the minimum weight if it is
+   below last, otherwise last, a lower bound */
+static int min_cut_weight(Pmin_cut_workspace w, int *weight_list, int size1, int **edges_list, int size2, Pincidence in){
+	int i,k,e,u,v,x,y,s,t,phase_cut;
+	int alive_number = size1;
+	int best = INT_MAX;
+	int sum = 0;
+	int *representative = w->representative;
+	int *member_next = w->member_next;
+	int *member_last = w->member_last;
+	int *member_size = w->member_size;
+	int *alive = w->alive;
+	bucket_queue q;
+
+	for (i = 0; i < size2; i++){
+		sum += weight_list[i];
+	}
+
+	q.last = sum < w->keys_number-1 ? sum : w->keys_number-1;
+	q.size = 0;
+	q.head = w->head;
+	q.next = w->next;
+	q.previous = w->previous;
+	q.key = w->key;
+	q.queued = w->queued;
+	for (k = 0; k <= q.last; k++){
+		q.head[k] = -1;
+	}
+
+	for (v = 0; v < size1; v++){
+		representative[v] = v;
+		member_next[v] = -1;
+		member_last[v] = v;
+		member_size[v] = 1;
+		alive[v] = v;
+		q.queued[v] = 0;
+	}
+
+	while (alive_number > 1){
+		/* maximum adjacency search from the first super-vertex */
+		q.top = 0;
+		for (k = 0; k < alive_number; k++){
+			bucket_push(&q,alive[k],0);
+		}
+
+		s = -1;
+		t = -1;
+		phase_cut = 0;
+		while (q.size > 0){
+			s = t;
+			t = bucket_pop(&q);
+			phase_cut = q.key[t];
+
+			for (x = t; x != -1; x = member_next[x]){
+				for (k = in->start[x]; k < in->start[x+1]; k++){
+					e = in->edges[k];
+					y = incidence_other_end(edges_list,e,x);
+					u = representative[y];
+					if (q.queued[u]){
+						bucket_add(&q,u,weight_list[e]);
+					}
+				}
+			}
+		}
+
+		/* the cut of the phase separates t from the other vertices */
+		if (phase_cut < best){
+			best = phase_cut;
+		}
+
+		/* t is merged into s, the smaller list is relabelled */
+		if (member_size[s] < member_size[t]){
+			u = s;
+			s = t;
+			t = u;
+		}
+		for (x = t; x != -1; x = member_next[x]){
+			representative[x] = s;
+		}
+		member_next[member_last[s]] = t;
+		member_last[s] = member_last[t];
+		member_size[s] += member_size[t];
+
+		for (k = 0; k < alive_number; k++){
+			if (alive[k] == t){
+				alive[k] = alive[--alive_number];
+				break;
+			}
+		}
+	}
+
+	return best < q.last ? best : q.last;
+}
+
+static int find_parent(int *parent, int v){
+	while (parent[v] != v){
+		parent[v] = parent[parent[v]];
+		v = parent[v];
+	}
+
+	return v;
+}
+
+/* the edges weighing at least bound are contracted : a cut lighter than
+   bound never separates their ends. The other edges between two parts are
+   written in reduced_edges, the number of parts is returned */
+static int contract_heavy_edges(Pmin_cut_workspace w, int *weight_list, int size1, int **edges_list, int size2, int bound, int *reduced_number){
+	int *parent = w->parent;
+	int *label = w->label;
+	int i,v,x,y;
+	int parts = 0;
+
+	for (v = 0; v < size1; v++){
+		parent[v] = v;
+	}
+	for (i = 0; i < size2; i++){
+		if (weight_list[i] >= bound){
+			x = find_parent(parent,edges_list[i][0]);
+			y = find_parent(parent,edges_list[i][1]);
+			if (x != y){
+				parent[x] = y;
+			}
+		}
+	}
+
+	for (v = 0; v < size1; v++){
+		label[v] = -1;
+	}
+	for (v = 0; v < size1; v++){
+		x = find_parent(parent,v);
+		if (label[x] == -1){
+			label[x] = parts++;
+		}
+	}
+
+	*reduced_number = 0;
+	for (i = 0; i < size2; i++){
+		x = label[find_parent(parent,edges_list[i][0])];
+		y = label[find_parent(parent,edges_list[i][1])];
+		if (x != y){
+			w->reduced_edges[*reduced_number][0] = x;
+			w->reduced_edges[*reduced_number][1] = y;
+			w->reduced_weight[(*reduced_number)++] = weight_list[i];
+		}
+	}
+
+	return parts;
+}
+
+static void heap_up(Pmin_cut_workspace w, int index){
+	int *heap = w->heap;
+	int *key = w->key;
+	int v = heap[index];
+	int parent;
+
+	while (index > 0){
+		parent = (index-1) / HEAP_ARITY;
+		if (key[v] <= key[heap[parent]]){
+			break;
+		}
+		heap[index] = heap[parent];
+		w->position[heap[index]] = index;
+		index = parent;
+	}
+	heap[index] = v;
+	w->position[v] = index;
+}
+
+static void heap_down(Pmin_cut_workspace w, int size){
+	int *heap = w->heap;
+	int *key = w->key;
+	int v = heap[0];
+	int index = 0;
+	int first,last,largest,c;
+
+	while ((first = index*HEAP_ARITY + 1) < size){
+		last = first + HEAP_ARITY < size ? first + HEAP_ARITY : size;
+		largest = first;
+		for (c = first+1; c < last; c++){
+			if (key[heap[c]] > key[heap[largest]]){
+				largest = c;
+			}
+		}
+		if (key[heap[largest]] <= key[v]){
+			break;
+		}
+		heap[index] = heap[largest];
+		w->position[heap[index]] = index;
+		index = largest;
+	}
+	heap[index] = v;
+	w->position[v] = index;
+}
+
+static int heap_pop(Pmin_cut_workspace w, int size){
+	int v = w->heap[0];
+
+	w->position[v] = -1;
+	if (size > 1){
+		w->heap[0] = w->heap[size-1];
+		heap_down(w,size-1);
+	}
+
+	return v;
+}
+
+/* maximum adjacency search from s, the order is written in order and the
+   lightest cut between a proper prefix of the order and the rest is
+   returned, the length of the prefix in prefix */
+static int search(Pmin_cut_workspace w, int *weight_list, int size1, int **edges_list, int s, int *order, int *prefix){
+	Pincidence in = w->incidence;
+	int *key = w->key;
+	char *visited = w->visited;
+	int k,e,u,y,size;
+	int cut = 0;
+	int best = INT_MAX;
+	int count = 0;
+
+	for (u = 0; u < size1; u++){
+		key[u] = 0;
+		visited[u] = 0;
+		w->heap[u] = u;
+		w->position[u] = u;
+	}
+	size = size1;
+	key[s] += size1+1;
+	heap_up(w,w->position[s]);
+
+	*prefix = 0;
+	while (size > 0){
+		u = heap_pop(w,size--);
+
+		for (k = in->start[u]; k < in->start[u+1]; k++){
+			e = in->edges[k];
+			y = incidence_other_end(edges_list,e,u);
+			cut += visited[y] ? -weight_list[e] : weight_list[e];
+			if (w->position[y] != -1){
+				key[y] += weight_list[e];
+				heap_up(w,w->position[y]);
+			}
+		}
+
+		visited[u] = 1;
+		order[count++] = u;
+		if (cut < best && count < size1){
+			best = cut;
+			*prefix = count;
+		}
+	}
+
+	return best;
+}
+
+Pmin_cut_workspace new_min_cut_workspace(int size1, int size2, int weight_sum){
+	Pmin_cut_workspace w = (min_cut_workspace*) malloc(sizeof(min_cut_workspace));
+
+	if (w == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	w->vertices_number = size1;
+	w->edges_number = size2;
+	w->keys_number = weight_sum+1;
+	w->incidence = new_empty_incidence(size1,size2);
+	w->representative = (int*) malloc((size1+1)*sizeof(int));
+	w->member_next = (int*) malloc((size1+1)*sizeof(int));
+	w->member_last = (int*) malloc((size1+1)*sizeof(int));
+	w->member_size = (int*) malloc((size1+1)*sizeof(int));
+	w->alive = (int*) malloc((size1+1)*sizeof(int));
+	w->head = (int*) malloc(w->keys_number*sizeof(int));
+	w->next = (int*) malloc((size1+1)*sizeof(int));
+	w->previous = (int*) malloc((size1+1)*sizeof(int));
+	w->key = (int*) malloc((size1+1)*sizeof(int));
+	w->queued = (char*) calloc(size1+1,sizeof(char));
+	w->heap = (int*) malloc((size1+1)*sizeof(int));
+	w->position = (int*) malloc((size1+1)*sizeof(int));
+	w->order = (int*) malloc((size1+1)*sizeof(int));
+	w->best_order = (int*) malloc((size1+1)*sizeof(int));
+	w->visited = (char*) malloc((size1+1)*sizeof(char));
+	w->parent = (int*) malloc((size1+1)*sizeof(int));
+	w->label = (int*) malloc((size1+1)*sizeof(int));
+	w->reduced_weight = (int*) malloc((size2+1)*sizeof(int));
+	w->reduced_incidence = new_empty_incidence(size1,size2);
+	allocate_matrix(&w->reduced_edges,size2+1,2);
+
+	if (w->representative == NULL || w->member_next == NULL || w->member_last == NULL
+		|| w->member_size == NULL || w->alive == NULL || w->head == NULL
+		|| w->next == NULL || w->previous == NULL || w->key == NULL || w->queued == NULL
+		|| w->heap == NULL || w->position == NULL || w->order == NULL
+		|| w->best_order == NULL || w->visited == NULL || w->parent == NULL
+		|| w->label == NULL || w->reduced_weight == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	return w;
+}
+
+Pmin_cut_workspace free_min_cut_workspace(Pmin_cut_workspace w){
+	free_incidence(w->incidence);
+	free(w->representative);
+	free(w->member_next);
+	free(w->member_last);
+	free(w->member_size);
+	free(w->alive);
+	free(w->head);
+	free(w->next);
+	free(w->previous);
+	free(w->key);
+	free(w->queued);
+	free(w->heap);
+	free(w->position);
+	free(w->order);
+	free(w->best_order);
+	free(w->visited);
+	free(w->parent);
+	free(w->label);
+	free(w->reduced_weight);
+	free_incidence(w->reduced_incidence);
+	free_matrix(w->reduced_edges,w->edges_number+1);
+	free(w);
+
+	return NULL;
+}
+
+int workspace_min_cut(Pmin_cut_workspace w, int *weight_list, int size1, int **edges_list, int size2, int *side){
+	int s,v,cut,prefix,parts,reduced_number;
+	int lightest = 0;
+	int best = INT_MAX;
+	int best_prefix = 0;
+	int *t;
+
+	if (side != NULL){
+		for (v = 0; v < size1; v++){
+			side[v] = 0;
+		}
+	}
+
+	if (size1 < 2){
+		return 0;
+	}
+
+	fill_incidence(w->incidence,edges_list,size1,size2);
+
+	/* the first start with the lightest cut wins, as in Boost : no later
+	   start can do better once a search has reached the minimum weight */
+	for (s = 0; s < size1 && best > lightest; s++){
+		cut = search(w,weight_list,size1,edges_list,s,w->order,&prefix);
+
+		/* the minimum weight is found on G with the edges heavier than the
+		   first cut contracted, the cuts lighter than it are all there. With
+		   too few buckets it is a lower bound, and more starts are searched */
+		if (s == 0){
+			lightest = cut;
+			parts = contract_heavy_edges(w,weight_list,size1,edges_list,size2,cut,&reduced_number);
+			if (parts > 1){
+				fill_incidence(w->reduced_incidence,w->reduced_edges,parts,reduced_number);
+				lightest = min_cut_weight(w,w->reduced_weight,parts,w->reduced_edges,reduced_number,w->reduced_incidence);
+				lightest = lightest < cut ? lightest : cut;
+			}
+		}
+
+		if (cut < best){
+			best = cut;
+			best_prefix = prefix;
+			t = w->best_order;
+			w->best_order = w->order;
+			w->order = t;
+		}
+	}
+
+	if (side != NULL){
+		for (v = 0; v < best_prefix; v++){
+			side[w->best_order[v]] = 1;
+		}
+	}
+
+	return best;
+}
+
+int min_cut(int *weight_list, int size1, int **edges_list, int size2, int *side){
+	int i;
+	int weight_sum = 0;
+	int best;
+	Pmin_cut_workspace w;
+
+	for (i = 0; i < size2; i++){
+		weight_sum += weight_list[i];
+	}
+
+	w = new_min_cut_workspace(size1,size2,weight_sum);
+	best = workspace_min_cut(w,weight_list,size1,edges_list,size2,side);
+	free_min_cut_workspace(w);
+
+	return best;
+}
+int* run_min_cut(int *weight_list, int size1, int **edges_list, int size2){
+	int i;
+	int *side = (int*) malloc((size1+1)*sizeof(int));
+	int *cut_list = (int*) calloc(size2+1,sizeof(int));
+
+	if (side == NULL || cut_list == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	min_cut(weight_list,size1,edges_list,size2,side);
+
+	for (i = 0; i < size2; i++){
+		cut_list[i] = side[edges_list[i][0]] != side[edges_list[i][1]];
+	}
+
+	free(side);
+
+	return cut_list;
+}
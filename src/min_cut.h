@@ -0,0 +1,145 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+/** @file min_cut.h
+ *
+ * @brief This file manages the minimum cut engine used by MBVST.
+ *
+ * It finds the cut of stoer_wagner_min_cut of Boost on flat arrays. Boost
+ * runs a maximum adjacency search from every vertex and keeps the lightest
+ * cut between a prefix of a search order and the other vertices, the first
+ * one found among the ties. Here the first search gives a cut of weight U,
+ * so the edges weighing U or more are never in a lighter cut and they are
+ * contracted (in MBVST, these are the edges of T). The weight of a minimum
+ * cut is then found on the contracted graph by the phases of Stoer-Wagner,
+ * where the super-vertices are lists of vertices over the incidence index of
+ * the edges and the maximum adjacency search uses a bucket priority queue,
+ * the keys being sums of small integer weights : a phase costs O(m + W),
+ * where W is the sum of the weights. Then the searches of Boost run on the
+ * whole graph from the next vertices only until one of them reaches that
+ * weight. They use a 4-ary heap which breaks the ties exactly like the
+ * d_ary_heap_indirect of Boost, so the cut is the one of run_stoer_wagner on
+ * every graph, ties included. The weights must be non negative, as for
+ * Boost.
+ */
+
+#ifndef MIN__CUT__H
+#define MIN__CUT__H
+
+#include "include.h"
+#include "incidence.h"
+
+/**
+ * \struct min_cut_workspace
+ * \brief buffers of the minimum cut engine
+ *
+ * \a Every array used by min_cut, sized once for at most vertices_number
+ *  vertices, edges_number edges and keys_number buckets (the largest sum of
+ *  the weights plus one), so the engine can run again and again on new graphs
+ *  without allocating : the super-vertices and the buckets of the phases,
+ *  then the heap of the searches with the position of every vertex in it
+ *  (-1 once out), the vertices already visited and the order of the current
+ *  search and of the best one, and the contraction of the heavy edges
+ *  (parent, label, reduced_edges, reduced_weight, reduced_incidence).
+ */
+typedef struct min_cut_workspace {
+	int vertices_number;
+	int edges_number;
+	int keys_number;
+	Pincidence incidence;
+	int *representative;
+	int *member_next;
+	int *member_last;
+	int *member_size;
+	int *alive;
+	int *head;
+	int *next;
+	int *previous;
+	int *key;
+	char *queued;
+	int *heap;
+	int *position;
+	int *order;
+	int *best_order;
+	char *visited;
+	int *parent;
+	int *label;
+	int **reduced_edges;
+	int *reduced_weight;
+	Pincidence reduced_incidence;
+} min_cut_workspace, *Pmin_cut_workspace;
+
+/**
+ * This function creates the buffers of the minimum cut engine.
+ * @param  size1       The largest number of vertices.
+ * @param  size2       The largest number of edges.
+ * @param  weight_sum  The largest sum of the weights.
+ * @return             The workspace.
+ */
+Pmin_cut_workspace new_min_cut_workspace(int size1, int size2, int weight_sum);
+
+/**
+ * This function frees the buffers of the minimum cut engine.
+ * @param  w The workspace.
+ * @return   A null pointer.
+ */
+Pmin_cut_workspace free_min_cut_workspace(Pmin_cut_workspace w);
+
+/**
+ * This function is min_cut with the buffers of a workspace. Nothing is
+ * allocated. If the weights exceed the weight_sum of the workspace, the
+ * larger keys of the phases share the last bucket : the cut is the same,
+ * but the searches may run from more vertices before they stop.
+ * @param  w           The workspace.
+ * @param  weight_list The weight of all edges.
+ * @param  size1       The number of vertices.
+ * @param  edges_list  The list of all edges.
+ * @param  size2       The size of edges_list.
+ * @param  side        If not NULL, filled with the side (0 or 1) of every
+ *                     vertex.
+ * @return             The weight of the cut.
+ */
+int workspace_min_cut(Pmin_cut_workspace w, int *weight_list, int size1, int **edges_list, int size2, int *side);
+
+/**
+ * This function computes a minimum cut of a graph given by its edges, the
+ * same as stoer_wagner_min_cut of Boost.
+ * @param  weight_list The weight of all edges.
+ * @param  size1       The number of vertices.
+ * @param  edges_list  The list of all edges.
+ * @param  size2       The size of edges_list.
+ * @param  side        If not NULL, filled with the side (0 or 1) of every
+ *                     vertex.
+ * @return             The weight of the cut.
+ */
+int min_cut(int *weight_list, int size1, int **edges_list, int size2, int *side);
+
+/**
+ * This function is run_stoer_wagner with the minimum cut engine.
+ * @param  weight_list The weight of all edges.
+ * @param  size1       The number of vertices.
+ * @param  edges_list  The list of all edges.
+ * @param  size2       The size of edges_list.
+ * @return             A list with 1 if corresponding edge is between two cuts,
+ *                     0 otherwise.
+ */
+int* run_min_cut(int *weight_list, int size1, int **edges_list, int size2);
+
+#endif
@@ -0,0 +1,157 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "include.h"
+#include "multi_start.h"
+#include "heuristic.h"
+#include "rng.h"
+
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/bind/bind.hpp>
+
+/**
+ * \struct multi_start_batch
+ * \brief work shared by the threads of MBVST_multi_start
+ *
+ * \a next is the next run to start, best the best tree of the finished runs
+ *  and stop is set once best reaches lower_bound.
+ */
+typedef struct multi_start_batch {
+	Pgraph g;
+	unsigned long long seed;
+	int runs;
+	int next;
+	int done;
+	int lower_bound;
+	int stop;
+	int best_run;
+	Pspanning_tree best;
+	boost::mutex lock;
+} multi_start_batch, *Pmulti_start_batch;
+
+static int batch_stopped(Pmulti_start_batch batch){
+	int stop;
+
+	batch->lock.lock();
+	stop = batch->stop;
+	batch->lock.unlock();
+
+	return stop;
+}
+
+static void multi_start_worker(Pmulti_start_batch batch){
+	Pmbvst_workspace w;
+	Pspanning_tree tree;
+	rng r;
+	int k,finished;
+
+	while (1){
+		batch->lock.lock();
+		k = batch->next++;
+		batch->lock.unlock();
+
+		if (k >= batch->runs || batch_stopped(batch)){
+			break;
+		}
+
+		w = new_mbvst_workspace(batch->g);
+		if (k > 0){
+			init_rng(&r,batch->seed,k);
+			w->r = &r;
+		}
+
+		finished = 1;
+		while (mbvst_step(w)){
+			if (batch_stopped(batch)){
+				finished = 0;
+				break;
+			}
+		}
+
+		tree = NULL;
+		if (finished){
+			tree = w->tree;
+			w->tree = NULL;
+		}
+		free_mbvst_workspace(w);
+
+		if (tree == NULL){
+			break;
+		}
+
+		batch->lock.lock();
+		batch->done++;
+		if (batch->best == NULL || tree->branch_vertices_number < batch->best->branch_vertices_number
+			|| (tree->branch_vertices_number == batch->best->branch_vertices_number && k < batch->best_run)){
+			if (batch->best != NULL){
+				free_spanning_tree(batch->best);
+			}
+			batch->best = tree;
+			batch->best_run = k;
+			tree = NULL;
+			batch->stop = batch->best->branch_vertices_number <= batch->lower_bound;
+		}
+		batch->lock.unlock();
+
+		if (tree != NULL){
+			free_spanning_tree(tree);
+		}
+	}
+}
+
+Pspanning_tree MBVST_multi_start(Pgraph g, int runs, int threads, unsigned long long seed, int *runs_done){
+	boost::thread_group workers;
+	multi_start_batch batch;
+	int k;
+
+	batch.g = g;
+	batch.seed = seed;
+	batch.runs = runs > 0 ? runs : 1;
+	batch.next = 0;
+	batch.done = 0;
+	batch.lower_bound = get_branch_vertex_lower_bound(g);
+	batch.stop = 0;
+	batch.best_run = -1;
+	batch.best = NULL;
+
+	if (threads <= 0){
+		threads = boost::thread::hardware_concurrency();
+	}
+	if (threads > batch.runs){
+		threads = batch.runs;
+	}
+
+	if (threads <= 1){
+		multi_start_worker(&batch);
+	}
+	else {
+		for (k = 0; k < threads; k++){
+			workers.create_thread(boost::bind(multi_start_worker,&batch));
+		}
+		workers.join_all();
+	}
+
+	if (runs_done != NULL){
+		*runs_done = batch.done;
+	}
+
+	return batch.best;
+}
@@ -0,0 +1,52 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+/** @file multi_start.h
+ *
+ * @brief This file manages the multi-start MBVST heuristic.
+ *
+ * Run 0 is MBVST itself, the other runs break the ties between the edges of
+ * the cuts at random, each with its own stream of the generator. The runs
+ * are shared by a pool of threads and the tree with the fewest branch
+ * vertices is kept, so the result is never worse than MBVST.
+ */
+
+#ifndef MULTI__START__H
+#define MULTI__START__H
+
+#include "include.h"
+#include "spanning_tree.h"
+
+/**
+ * This function applies the MBVST heuristic to graph G several times with
+ * random tie-breaking and keeps the best tree. The runs stop as soon as a
+ * tree reaches get_branch_vertex_lower_bound, this tree is then optimal.
+ * Without this early stop the tree only depends on the seed : the best of
+ * the runs, the smallest run on ties.
+ * @param  g          The graph G.
+ * @param  runs       The number of runs.
+ * @param  threads    The number of threads, 0 for one by core.
+ * @param  seed       The seed of the random streams.
+ * @param  runs_done  If not NULL, filled with the number of finished runs.
+ * @return            The best cover tree.
+ */
+Pspanning_tree MBVST_multi_start(Pgraph g, int runs, int threads, unsigned long long seed, int *runs_done);
+
+#endif
@@ -22,6 +22,14 @@ CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 #include "graph.h"
 #include "random_graph.h"
 #include "tools.h"
+#include "dynamic_connectivity.h"
+#include "edge_table.h"
+#include "rng.h"
+#include "edge_sampler.h"
+#include "scc.h"
+#include "bridges.h"
+#include "block_decomposition.h"
+#include "spanning_tree.h"
 
 int roy_warshall(Pgraph g){
 	int w,u,v;
@@ -39,44 +47,65 @@ int roy_warshall(Pgraph g){
 	return 1;
 }
 
-int remove_random_edges(Pgraph g, int n){
+int remove_random_edges(Pgraph g, int n, int keep_connected, Prng r){
+	Pedge_sampler s;
+	int removed;
+
+	/* the sampler stays attached for the next calls, it is only detached
+	   while remove_sampled_edges keeps it up to date itself */
+	attach_edge_sampler(g);
+	s = g->sampler;
+	g->sampler = NULL;
+	removed = remove_sampled_edges(g,s,n,keep_connected,r);
+	g->sampler = s;
+
+	return removed == n;
+}
+
+int remove_sampled_edges(Pgraph g, Pedge_sampler s, int n, int keep_connected, Prng r){
 	int x,y;
-	int** am = g->adjacency_matrix;
-	int size = g->vertices_number;
+	int removed = 0;
+	int attached = g->connectivity != NULL;
+
+	if (keep_connected && !attached){
+		attach_connectivity(g);
+	}
+	/* the bridges parked by a previous call can go */
+	if (!keep_connected){
+		edge_sampler_unpark(s);
+	}
 
-	while(n > 0) {
-		x = rand() % size;
-		y = rand() % size;
+	while (removed < n && edge_sampler_pick(s,r,&x,&y)){
+		remove_edge(g,x,y);
 
-		if (am[x][y] == 1 && x!=y){
-			remove_edge(g,x,y);
-			n --;
+		/* a bridge is put back and will not be drawn again */
+		if (keep_connected && !connectivity_connected(g->connectivity,x,y)){
+			add_edge(g,x,y);
+			edge_sampler_park(s,x,y);
+			continue;
 		}
+
+		edge_sampler_remove(s,x,y);
+		removed++;
 	}
-	return 1;
+
+	if (keep_connected && !attached){
+		detach_connectivity(g);
+	}
+
+	return removed;
 }
 
 int test_connected(Pgraph g){
-	int i,j;
-	int size = g->vertices_number;
+	/* one component, no transitive closure needed */
+	Pscc s = new_scc(g);
+	int connected = s->components_number <= 1;
 
-	Pgraph g_copy = copy_graph(g);
-	roy_warshall(g_copy);
-	// print_graph(g_copy,1);
-
-	for (i = 0; i < size; i++){
-		for (j = i; j < size; j++){
-			if (!test_x_y_connected(g_copy,i,j)){
-				free_graph(g_copy);
-				return 0;
-			}
-		}
-	}
-	free_graph(g_copy);
-	return 1;
+	free_scc(s);
+	return connected;
 }
 
-int test_connected_v2(Pgraph g, int method){
+int test_connected_v2(Pgraph g, int method, Prng r){
 	int i,j;
 	int size = g->vertices_number;
 	int check = 0;
@@ -99,9 +128,13 @@ int test_connected_v2(Pgraph g, int method){
 		}
 		free_graph(g_copy);
 	}
-	else{
+	else if (method == 1){
 		check = run_dfs(g) != size;
 	}
+	else{
+		attach_connectivity(g);
+		check = connectivity_components_number(g->connectivity) != 1;
+	}
 
 
 	/* => if everything is connected, it's done */
@@ -110,49 +143,91 @@ int test_connected_v2(Pgraph g, int method){
 	}
 
 	/* => if not, it remains some job to do*/
+	repair_connectivity(g,r);
 
-	/*********************************************************/
-	/* Second step : count the number of connected components*/
-	/*********************************************************/
+	return 1;
+}
 
-	int ** reached = connected_components_vertices(g);
+int repair_connectivity(Pgraph g, Prng r){
+	int i,k,x,y;
+	int size = g->vertices_number;
+	int traversals = 0;
 	int number_components = 0;
+	int non_tree_number = 0;
+	int *representatives;
+	int **edges_list;
+	Pbridge_set bridges;
+
+	/********************************************************/
+	/* Without the dynamic connectivity structure : one DFS */
+	/*  gives the components and the bridges, then k-1      */
+	/*  uniform edges which are not bridges are removed     */
+	/********************************************************/
+
+	if (!g->connectivity){
+		bridges = new_bridge_set(g);
+		traversals++;
+
+		number_components = bridges->components_number;
+		for (i = 0; i < number_components-1; i++){
+			add_edge(g,bridges->representatives[i],bridges->representatives[i+1]);
+		}
 
-	for (i = 0; i < size; i++){
-		if (reached[i][1] > number_components){
-			number_components++;
+		/* the links are bridges, they are never drawn */
+		for (i = 0; i < number_components-1 && bridge_set_pick(bridges,r,&x,&y); i++){
+			bridge_set_remove(bridges,x,y);
 		}
+
+		free_bridge_set(bridges);
+
+		return traversals;
 	}
-	number_components+=1;
 
-	/**************************************************/
-	/* Third step : link all the connected components */
-	/*        with number_components-1 edge           */
-	/**************************************************/
+	/******************************************************/
+	/* First step : connected components and the edges we */
+	/*      can remove without disconnecting anything     */
+	/******************************************************/
+
+	representatives = (int *)malloc(size*sizeof(int));
+	if (representatives == NULL){
+		exit(EXIT_FAILURE);
+	}
 
-	int vertice_to_link_tab[number_components];
-	int current_cc = 0;
 	for (i = 0; i < size; i++){
-		if (reached[i][1] == current_cc){
-			vertice_to_link_tab[current_cc] = i;
-			current_cc++;
+		if (connectivity_representative(g->connectivity,i) == i){
+			representatives[number_components++] = i;
 		}
 	}
 
+	edges_list = connectivity_non_tree_edges(g->connectivity,&non_tree_number);
+
+	/**************************************************/
+	/* Second step : link all the connected components */
+	/*        with number_components-1 edge           */
+	/**************************************************/
+
 	for (i = 0; i < number_components-1; i++){
-		add_edge(g,vertice_to_link_tab[i],vertice_to_link_tab[i+1]);
+		add_edge(g,representatives[i],representatives[i+1]);
 	}
 
-	/**********************************************************/
-	/* FOURTH step : remove number_components-1 edge randomly */
-	/**********************************************************/
-
-	remove_random_edges(g,number_components-1);
+	/***********************************************************/
+	/* Third step : remove number_components-1 non tree edges, */
+	/*   the forest plus the links is a spanning tree of G     */
+	/***********************************************************/
+
+	for (i = 0; i < number_components-1 && i < non_tree_number; i++){
+		k = i + rng_uniform(r,non_tree_number - i);
+		x = edges_list[k][0];
+		y = edges_list[k][1];
+		edges_list[k][0] = edges_list[i][0];
+		edges_list[k][1] = edges_list[i][1];
+		remove_edge(g,x,y);
+	}
 
-	free_matrix(reached,size);
-	test_connected_v2(g,method);
+	free_matrix(edges_list,non_tree_number);
+	free(representatives);
 
-	return 1;
+	return traversals;
 }
 
 int run_dfs(Pgraph g){
@@ -257,16 +332,45 @@ int get_vertex_type(Pgraph g, int v){
 }
 
 int *get_vertices_type_list(Pgraph g){
-	int i;
+	int i,k,degree,components;
 	int size = g->vertices_number;
-	int vertice_type = 0;
-	int* vertice_type_list = (int *)calloc(size,sizeof(int));
+	int* vertice_type_list = (int *)calloc(size+1,sizeof(int));
+	int* blocks = (int *)calloc(size+1,sizeof(int));
+	Pblock_cut_tree t = new_block_cut_tree(g);
+	Pspanning_tree forest = graph_to_spanning_tree(g);
+
+	if (vertice_type_list == NULL || blocks == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	/* without v, the component of v splits into one part per block holding
+	 * v, so G-v has (size-forest edges)-1+blocks(v) components */
+	for (k = 0; k < t->block_start[t->blocks_number]; k++){
+		blocks[t->block_vertices[k]]++;
+	}
 
 	for (i = 0; i < size; i++){
-		vertice_type = get_vertex_type(g,i);
-		vertice_type_list[i] = vertice_type;
+		degree = get_vertex_degree(g,i);
+		components = size - forest->edges_number - 1 + blocks[i];
+
+		if (degree == 1 ||(degree == 2 && components == 2)){
+			vertice_type_list[i] = 0;
+		}
+		else if(degree == 2 && components == 1){
+			vertice_type_list[i] = 1;
+		}
+		else if (degree >= 3 && components <= 2){
+			vertice_type_list[i] = 2;
+		}
+		else{
+			vertice_type_list[i] = 3;
+		}
 	}
 
+	free_block_cut_tree(t);
+	free_spanning_tree(forest);
+	free(blocks);
+
 	return vertice_type_list;
 }
 
@@ -294,6 +398,14 @@ void modify_weight_list(int v, int *weight_list, int **edges_list, int size, int
 	return;
 }
 
+void modify_incident_weight_list(int v, int *weight_list, Pincidence in, int modifier){
+	int k;
+
+	for (k = in->start[v]; k < in->start[v+1]; k++){
+		weight_list[in->edges[k]]+=modifier;
+	}
+}
+
 int test_x_y_strongly_connected(Pgraph g, int x, int y){
 	return g->adjacency_matrix[x][y] && g->adjacency_matrix[y][x];
 }
@@ -302,31 +414,146 @@ int test_x_y_connected(Pgraph g, int x, int y){
 	return g->adjacency_matrix[x][y];
 }
 
-Pgraph generate_random_graph(int size, int density, int method){
+Pgraph generate_random_graph(int size, int density, int method, Prng r){
 	int x,y;
 	Pgraph g = new_graph(size);
 	int** am = g->adjacency_matrix;
 	int edge_number = 0;
 
-	do{
-		clean_graph(g);
-		edge_number = 0;
-		// printf("Nouveau\n");
-		while (edge_number < density){
+	/* the structure follows every change made by add_edge and remove_edge */
+	if (method == 2){
+		attach_connectivity(g);
+	}
 
-			x = rand() % size;
-			y = rand() % size;
+	while (edge_number < density){
 
-			if (am[x][y] == 0 && x!=y){
-				am[x][y] = 1;
-				am[y][x] = 1;
-				edge_number ++;
-			}
+		x = rng_uniform(r,size);
+		y = rng_uniform(r,size);
+
+		if (am[x][y] == 0 && x!=y){
+			add_edge(g,x,y);
+			edge_number ++;
 		}
+	}
 
-		set_edges_number(g,edge_number);
-	} while(!test_connected_v2(g,method));
+	set_edges_number(g,edge_number);
+
+	/* the components are linked by the repair, a single draw is enough */
+	test_connected_v2(g,method,r);
 
 	return g;
 
-}
\ No newline at end of file
+}
+
+int** generate_random_connected_edges_list(int size, int density, Prng r){
+	int i,v,x,y,ptr,leaf;
+	int k = 0;
+	int **edges_list;
+	int *prufer;
+	int *degree;
+	Pedge_table edges_index;
+
+	if (density < size-1 || density > (long long)size*(size-1)/2){
+		return NULL;
+	}
+
+	allocate_matrix(&edges_list,density,2);
+
+	if (size < 2){
+		return edges_list;
+	}
+
+	prufer = (int *)malloc(size*sizeof(int));
+	degree = (int *)malloc(size*sizeof(int));
+	edges_index = new_edge_table(density);
+
+	if (prufer == NULL || degree == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	/******************************************************/
+	/* First step : a uniform random spanning tree, given */
+	/*     by a random Prufer sequence decoded in O(n)    */
+	/******************************************************/
+
+	for (i = 0; i < size; i++){
+		degree[i] = 1;
+	}
+	for (i = 0; i < size-2; i++){
+		prufer[i] = rng_uniform(r,size);
+		degree[prufer[i]]++;
+	}
+
+	ptr = 0;
+	while (degree[ptr] != 1){
+		ptr++;
+	}
+	leaf = ptr;
+
+	for (i = 0; i < size-2; i++){
+		v = prufer[i];
+		edges_list[k][0] = leaf;
+		edges_list[k][1] = v;
+		edge_table_put(edges_index,leaf,v,k);
+		k++;
+
+		degree[v]--;
+		if (degree[v] == 1 && v < ptr){
+			leaf = v;
+		}
+		else{
+			ptr++;
+			while (degree[ptr] != 1){
+				ptr++;
+			}
+			leaf = ptr;
+		}
+	}
+
+	edges_list[k][0] = leaf;
+	edges_list[k][1] = size-1;
+	edge_table_put(edges_index,leaf,size-1,k);
+	k++;
+
+	/*********************************************************/
+	/* Second step : the other edges, duplicates are rejected */
+	/*               with the hash table                      */
+	/*********************************************************/
+
+	while (k < density){
+		x = rng_uniform(r,size);
+		y = rng_uniform(r,size);
+
+		if (x != y && edge_table_get(edges_index,x,y) == -1){
+			edges_list[k][0] = x;
+			edges_list[k][1] = y;
+			edge_table_put(edges_index,x,y,k);
+			k++;
+		}
+	}
+
+	free(prufer);
+	free(degree);
+	free_edge_table(edges_index);
+
+	return edges_list;
+}
+
+Pgraph generate_random_connected_graph(int size, int density, Prng r){
+	int i;
+	Pgraph g = new_graph(size);
+	int **edges_list = generate_random_connected_edges_list(size,density,r);
+
+	if (edges_list == NULL){
+		free_graph(g);
+		return NULL;
+	}
+
+	for (i = 0; i < density; i++){
+		add_edge(g,edges_list[i][0],edges_list[i][1]);
+	}
+
+	free_matrix(edges_list,density);
+
+	return g;
+}
@@ -28,6 +28,9 @@ CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 #define RANDOM__GRAPH__H
 
 #include "include.h"
+#include "rng.h"
+#include "edge_sampler.h"
+#include "incidence.h"
 
 /**
  * This function computes the transitive closure of a graph G.
@@ -37,27 +40,60 @@ CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 int roy_warshall(Pgraph g);
 
 /**
- * This function removes randomly n edges to graph G.
- * @param  g    The graph G.
- * @param  g    The number of edges we want to remove.
- * @return      1 if success, 0 if failure.
+ * This function removes randomly n edges to graph G. The edges are drawn
+ * uniformly from the edge sampler of G instead of the adjacency matrix : it
+ * is attached by the first call, in O(n^2), and kept up to date by
+ * add_edge and remove_edge, so the next calls cost O(1) per edge.
+ * @param  g              The graph G.
+ * @param  n              The number of edges we want to remove.
+ * @param  keep_connected 1 to only remove edges which are not bridges, 0
+ *                        otherwise.
+ * @param  r              The random number generator.
+ * @return                1 if success, 0 if failure.
  */
-int remove_random_edges(Pgraph g, int n);
+int remove_random_edges(Pgraph g, int n, int keep_connected, Prng r);
 
 /**
- * This function test if G is connected recursively without dropping G if
- * it's not the case.
- * @param  g The graph G.
- * @return   1 if connected, 0 otherwise.
+ * This function removes randomly n edges to graph G, drawn from an edge
+ * sampler of G kept up to date by the function. Every draw is O(1). To keep
+ * G connected, a drawn bridge is parked in the sampler (the parked edges are
+ * drawn again when keep_connected is 0), the bridges are found
+ * with the dynamic connectivity structure (attached for the call if needed).
+ * @param  g              The graph G.
+ * @param  s              An edge sampler of G.
+ * @param  n              The number of edges we want to remove.
+ * @param  keep_connected 1 to only remove edges which are not bridges, 0
+ *                        otherwise.
+ * @param  r              The random number generator.
+ * @return                The number of edges removed.
  */
-int test_connected_v2(Pgraph g, int method);
+int remove_sampled_edges(Pgraph g, Pedge_sampler s, int n, int keep_connected, Prng r);
 
 /**
- * This function test if G is connected.
+ * This function test if G is connected recursively without dropping G if
+ * it's not the case.
+ * @param  g      The graph G.
+ * @param  method The method to check connectivity : 0 is RW, 1 is DFS and 2
+ *                is the dynamic connectivity structure attached to G (it is
+ *                attached if needed).
+ * @param  r      The random number generator used by the repair.
+ * @return        1 if connected, 0 otherwise.
+ */
+int test_connected_v2(Pgraph g, int method, Prng r);
+
+/**
+ * This function makes G connected without changing its number of edges, in
+ * a single pass : the connected components are linked by a chain of
+ * number_components-1 new edges, then as many edges which are not bridges
+ * are removed at random. Without a dynamic connectivity structure, they are
+ * drawn uniformly among all the edges which are not bridges (see bridges.h),
+ * otherwise among the edges outside its spanning forest.
  * @param  g The graph G.
- * @return   1 if connected, 0 otherwise.
+ * @param  r The random number generator.
+ * @return   The number of traversals of the adjacency matrix of G used : 1,
+ *           or 0 if a dynamic connectivity structure is attached to G.
  */
-int test_connected(Pgraph g);
+int repair_connectivity(Pgraph g, Prng r);
 
 /**
  * This function computes a DFS on G.
@@ -111,7 +147,9 @@ int connected_components_two_vertices(Pgraph g, int i, int j);
 int get_vertex_type(Pgraph g, int v);
 
 /**
- * This function returns the type of each vertex of the graph G.
+ * This function returns the type of each vertex of the graph G. The
+ * components of G without v are counted with the blocks of G (see
+ * block_decomposition.h) instead of one DFS per vertex, so it is O(n^2).
  * @param  g The graph G.
  * @return   The association list of the type of each vertex..
  */
@@ -135,6 +173,15 @@ int *get_weight_list(Pgraph g);
  */
 void modify_weight_list(int v, int *weight_list, int **edges_list, int size, int modifier);
 
+/**
+ * This function is modify_weight_list in O(deg(v)).
+ * @param  v           The vertex v
+ * @param  weight_list The weight list.
+ * @param  in          The incident edges of the edges list.
+ * @param  modifier    The number we add.
+ */
+void modify_incident_weight_list(int v, int *weight_list, Pincidence in, int modifier);
+
 /**
  * This function tests if two vertices belongs to the same connected
  * component of a graph G.
@@ -146,7 +193,19 @@ void modify_weight_list(int v, int *weight_list, int **edges_list, int size, int
 int test_x_y_connected(Pgraph g, int x, int y);
 
 /**
- * This function tests if a graph is connected
+ * This function tests if two vertices are strongly connected, G being a
+ * transitive closure.
+ * @param  g The graph G.
+ * @param  x The first vertex.
+ * @param  y The second vertex.
+ * @return   1 if true, otherwise 0.
+ */
+int test_x_y_strongly_connected(Pgraph g, int x, int y);
+
+/**
+ * This function tests if a graph is connected (strongly connected if it is
+ * directed : every vertex reaches every other one), with its strongly
+ * connected components. A graph with at most one vertex is connected.
  * @param  g The graph we want to test.
  * @return   1 if true, otherwise 0;
  */
@@ -157,10 +216,39 @@ int test_connected(Pgraph g);
  * density.
  * @param  size    The size we want.
  * @param  density The density we want.
- * @param  method  The method to check connectivity : 0 is RW and 1 is DFS.
+ * @param  method  The method to check connectivity : 0 is RW, 1 is DFS and 2
+ *                 is the dynamic connectivity structure, which stays attached
+ *                 to the returned graph.
+ * @param  r       The random number generator.
  * @return         A connected graph with the required size and density.
  */
-Pgraph generate_random_graph(int size, int density, int method);
+Pgraph generate_random_graph(int size, int density, int method, Prng r);
+
+/**
+ * This function generates the edges of a random connected graph given his
+ * size and his density, without any connectivity test : a uniform random
+ * spanning tree is decoded from a random Prufer sequence, then the
+ * density-(size-1) other edges are sampled, duplicates being rejected with a
+ * hash table. Time and memory are O(size+density).
+ * @param  size    The size we want.
+ * @param  density The density we want, between size-1 and size(size-1)/2.
+ * @param  r       The random number generator.
+ * @return         The list of the edges (density x 2, free it with
+ *                 free_matrix), the size-1 first ones form the spanning tree,
+ *                 or NULL if the density is not reachable.
+ */
+int** generate_random_connected_edges_list(int size, int density, Prng r);
+
+/**
+ * This function generates a random connected graph given his size and his
+ * density with generate_random_connected_edges_list.
+ * @param  size    The size we want.
+ * @param  density The density we want.
+ * @param  r       The random number generator.
+ * @return         A connected graph with the required size and density, or
+ *                 NULL if the density is not reachable.
+ */
+Pgraph generate_random_connected_graph(int size, int density, Prng r);
 
 
 #endif
@@ -0,0 +1,100 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "include.h"
+#include "rng.h"
+
+#define GOLDEN_GAMMA 0x9e3779b97f4a7c15ULL
+
+unsigned long long hash64(unsigned long long z){
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+	return z ^ (z >> 31);
+}
+
+/* the gamma of SplitMix : odd, with enough bit transitions */
+static unsigned long long mix_gamma(unsigned long long z){
+	int transitions;
+
+	z = hash64(z) | 1ULL;
+	transitions = __builtin_popcountll(z ^ (z >> 1));
+	if (transitions < 24){
+		z ^= 0xaaaaaaaaaaaaaaaaULL;
+	}
+
+	return z;
+}
+
+void init_rng(Prng r, unsigned long long seed, unsigned long long stream){
+	unsigned long long key = hash64(seed + GOLDEN_GAMMA);
+
+	r->start = hash64(key ^ hash64(2*stream + 1));
+	r->gamma = mix_gamma(key + stream * GOLDEN_GAMMA);
+	r->counter = 0;
+}
+
+Prng new_rng(unsigned long long seed, unsigned long long stream){
+	Prng r = (rng*) malloc(sizeof(rng));
+
+	if (r == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	init_rng(r,seed,stream);
+
+	return r;
+}
+
+void split_rng(Prng r, unsigned long long stream, Prng child){
+	init_rng(child,rng_next(r),stream);
+}
+
+unsigned long long rng_next(Prng r){
+	return hash64(r->start + (r->counter++) * r->gamma);
+}
+
+int rng_uniform(Prng r, int bound){
+	unsigned long long x = rng_next(r) >> 32;
+	unsigned long long m = x * (unsigned long long)bound;
+	unsigned int low = (unsigned int)m;
+	unsigned int threshold;
+
+	/* Lemire's method : reject the few values of the incomplete last range */
+	if (low < (unsigned int)bound){
+		threshold = (0u - (unsigned int)bound) % (unsigned int)bound;
+		while (low < threshold){
+			x = rng_next(r) >> 32;
+			m = x * (unsigned long long)bound;
+			low = (unsigned int)m;
+		}
+	}
+
+	return (int)(m >> 32);
+}
+
+double rng_double(Prng r){
+	return (rng_next(r) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+Prng free_rng(Prng r){
+	free(r);
+
+	return NULL;
+}
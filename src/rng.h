@@ -0,0 +1,113 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+/** @file rng.h
+ *
+ * @brief This file manages the random number generators.
+ *
+ * A generator is counter based, in the SplitMix style : the i-th number of a
+ * stream is a bijective mix of start + i * gamma, where start and the odd
+ * gamma only depend on (seed, stream). Streams are independent objects
+ * without any global state, so every thread can own one and a run is
+ * reproducible for a given seed and stream numbering.
+ */
+
+#ifndef RNG__H
+#define RNG__H
+
+#include "include.h"
+
+/**
+ * \struct rng
+ * \brief random number generator
+ *
+ * \a A generator is given by the constants of its stream and the number of
+ *  values already drawn.
+ */
+typedef struct rng {
+	unsigned long long start;
+	unsigned long long gamma;
+	unsigned long long counter;
+} rng, *Prng;
+
+/**
+ * This function initializes the generator of a stream.
+ * @param r      The generator.
+ * @param seed   The seed of the run.
+ * @param stream The number of the stream (a thread, an instance ...).
+ */
+void init_rng(Prng r, unsigned long long seed, unsigned long long stream);
+
+/**
+ * This function returns a new generator allocated in the heap.
+ * @param  seed   The seed of the run.
+ * @param  stream The number of the stream.
+ * @return        A new generator.
+ */
+Prng new_rng(unsigned long long seed, unsigned long long stream);
+
+/**
+ * This function initializes a child generator from the current state of a
+ * parent, the parent moves forward by one value. Children with different
+ * stream numbers are independent.
+ * @param r      The parent generator.
+ * @param stream The number of the child stream.
+ * @param child  The child generator.
+ */
+void split_rng(Prng r, unsigned long long stream, Prng child);
+
+/**
+ * This function returns the next 64 random bits of a generator.
+ * @param  r The generator.
+ * @return   A uniform 64 bits integer.
+ */
+unsigned long long rng_next(Prng r);
+
+/**
+ * This function returns a uniform integer in [0,bound), without modulo bias.
+ * @param  r     The generator.
+ * @param  bound The bound, strictly positive.
+ * @return       A uniform integer in [0,bound).
+ */
+int rng_uniform(Prng r, int bound);
+
+/**
+ * This function returns a uniform real number in [0,1).
+ * @param  r The generator.
+ * @return   A uniform real number in [0,1).
+ */
+double rng_double(Prng r);
+
+/**
+ * This function mixes the bits of a 64 bits integer (the bijective finalizer
+ * of SplitMix), to hash keys.
+ * @param  z The integer.
+ * @return   The mixed integer.
+ */
+unsigned long long hash64(unsigned long long z);
+
+/**
+ * This function frees a generator allocated in the heap.
+ * @param  r The generator.
+ * @return   A null pointer.
+ */
+Prng free_rng(Prng r);
+
+#endif
@@ -0,0 +1,254 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "include.h"
+#include "scc.h"
+#include "tools.h"
+
+/* iterative Tarjan, the components are labelled in the order they end */
+static void label_components(Pscc s, Pgraph g){
+	int** am = g->adjacency_matrix;
+	int n = g->vertices_number;
+	int *index = (int*)allocate(n*sizeof(int));
+	int *low = (int*)allocate(n*sizeof(int));
+	int *next = (int*)allocate(n*sizeof(int));
+	int *call_stack = (int*)allocate(n*sizeof(int));
+	int *stack = (int*)allocate(n*sizeof(int));
+	int counter = 0;
+	int call_top;
+	int top = 0;
+	int root,u,w;
+
+	for (u = 0; u < n; u++){
+		index[u] = -1;
+		s->component[u] = -1;
+	}
+
+	for (root = 0; root < n; root++){
+		if (index[root] != -1){
+			continue;
+		}
+
+		call_top = 0;
+		call_stack[call_top++] = root;
+		index[root] = low[root] = counter++;
+		next[root] = 0;
+		stack[top++] = root;
+
+		while (call_top > 0){
+			u = call_stack[call_top-1];
+
+			if (next[u] < n){
+				w = next[u]++;
+				if (!am[u][w]){
+					continue;
+				}
+				if (index[w] == -1){
+					index[w] = low[w] = counter++;
+					next[w] = 0;
+					stack[top++] = w;
+					call_stack[call_top++] = w;
+				}
+				else if (s->component[w] == -1 && index[w] < low[u]){
+					low[u] = index[w];
+				}
+				continue;
+			}
+
+			/* u is done */
+			call_top--;
+			if (low[u] == index[u]){
+				do {
+					w = stack[--top];
+					s->component[w] = s->components_number;
+				} while (w != u);
+				s->components_number++;
+			}
+			if (call_top > 0 && low[u] < low[call_stack[call_top-1]]){
+				low[call_stack[call_top-1]] = low[u];
+			}
+		}
+	}
+
+	free(index);
+	free(low);
+	free(next);
+	free(call_stack);
+	free(stack);
+}
+
+/* the edges between the components, without duplicates */
+static void build_condensation(Pscc s, Pgraph g){
+	int** am = g->adjacency_matrix;
+	int n = g->vertices_number;
+	int k = s->components_number;
+	int *order = (int*)allocate(n*sizeof(int));
+	int *start = (int*)allocate((k+1)*sizeof(int));
+	int *mark = (int*)allocate(k*sizeof(int));
+	int capacity = n > 16 ? n : 16;
+	int edges_number = 0;
+	int c,u,v,i;
+
+	/* the vertices sorted by component */
+	for (c = 0; c <= k; c++){
+		start[c] = 0;
+	}
+	for (u = 0; u < n; u++){
+		start[s->component[u]+1]++;
+		s->component_size[s->component[u]]++;
+	}
+	for (c = 0; c < k; c++){
+		start[c+1] += start[c];
+		mark[c] = -1;
+	}
+	for (u = 0; u < n; u++){
+		order[start[s->component[u]]++] = u;
+	}
+	for (c = k; c > 0; c--){
+		start[c] = start[c-1];
+	}
+	start[0] = 0;
+
+	s->dag_targets = (int*)allocate(capacity*sizeof(int));
+	for (c = 0; c < k; c++){
+		s->dag_start[c] = edges_number;
+		mark[c] = c;
+		for (i = start[c]; i < start[c+1]; i++){
+			u = order[i];
+			for (v = 0; v < n; v++){
+				if (am[u][v] && mark[s->component[v]] != c){
+					mark[s->component[v]] = c;
+					if (edges_number == capacity){
+						capacity *= 2;
+						s->dag_targets = (int*)realloc(s->dag_targets,capacity*sizeof(int));
+						if (s->dag_targets == NULL){
+							exit(EXIT_FAILURE);
+						}
+					}
+					s->dag_targets[edges_number++] = s->component[v];
+				}
+			}
+		}
+	}
+	s->dag_start[k] = edges_number;
+
+	free(order);
+	free(start);
+	free(mark);
+}
+
+Pscc new_scc(Pgraph g){
+	int n = g->vertices_number;
+	int c;
+	Pscc s = (scc*)allocate(sizeof(scc));
+
+	s->vertices_number = n;
+	s->components_number = 0;
+	s->component = (int*)allocate((n+1)*sizeof(int));
+	s->component_size = (int*)allocate((n+1)*sizeof(int));
+	s->dag_start = (int*)allocate((n+1)*sizeof(int));
+	s->words_number = 0;
+	s->reachable = NULL;
+
+	for (c = 0; c <= n; c++){
+		s->component_size[c] = 0;
+	}
+
+	label_components(s,g);
+	build_condensation(s,g);
+
+	return s;
+}
+
+int scc_component(Pscc s, int v){
+	return s->component[v];
+}
+
+int scc_strongly_connected(Pscc s, int x, int y){
+	return s->component[x] == s->component[y];
+}
+
+/* successors have smaller labels, so their bitsets are ready first */
+static void build_reachability(Pscc s){
+	int k = s->components_number;
+	int w = (k+63)/64;
+	int c,e,i;
+	unsigned long long *row;
+	unsigned long long *successor;
+
+	s->words_number = w;
+	s->reachable = (unsigned long long*)calloc((size_t)k*w+1,sizeof(unsigned long long));
+	if (s->reachable == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	for (c = 0; c < k; c++){
+		row = s->reachable + (size_t)c*w;
+		row[c/64] |= 1ULL << (c%64);
+		for (e = s->dag_start[c]; e < s->dag_start[c+1]; e++){
+			successor = s->reachable + (size_t)s->dag_targets[e]*w;
+			for (i = 0; i <= s->dag_targets[e]/64; i++){
+				row[i] |= successor[i];
+			}
+		}
+	}
+}
+
+int scc_reachable(Pscc s, int x, int y){
+	int cx = s->component[x];
+	int cy = s->component[y];
+
+	if (cx == cy){
+		return 1;
+	}
+	if (cy > cx){
+		return 0;
+	}
+	if (s->reachable == NULL){
+		build_reachability(s);
+	}
+
+	return (s->reachable[(size_t)cx*s->words_number + cy/64] >> (cy%64)) & 1ULL;
+}
+
+Pgraph scc_condensation(Pscc s){
+	int c,e;
+	Pgraph d = new_graph(s->components_number);
+
+	for (c = 0; c < s->components_number; c++){
+		for (e = s->dag_start[c]; e < s->dag_start[c+1]; e++){
+			d->adjacency_matrix[c][s->dag_targets[e]] = 1;
+			d->edges_number++;
+		}
+	}
+
+	return d;
+}
+
+Pscc free_scc(Pscc s){
+	free(s->component);
+	free(s->component_size);
+	free(s->dag_start);
+	free(s->dag_targets);
+	free(s->reachable);
+	free(s);
+
+	return NULL;
+}
@@ -0,0 +1,110 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+/** @file scc.h
+ *
+ * @brief This file manages the strongly connected components of a graph.
+ *
+ * The components are computed once, in O(n^2) on the adjacency matrix, instead
+ * of the O(n^3) transitive closure of roy_warshall. Two vertices are strongly
+ * connected if they have the same label, and the reachability is answered by
+ * bitsets over the condensation, which is a DAG.
+ */
+
+#ifndef SCC__H
+#define SCC__H
+
+#include "include.h"
+#include "graph.h"
+
+/**
+ * \struct scc
+ * \brief strongly connected components structure
+ *
+ * \a The components are numbered in reverse topological order : every edge
+ *  of the condensation goes from a component to a smaller one. The
+ *  condensation is stored as adjacency arrays (the successors of c are
+ *  dag_targets[dag_start[c]] ... dag_targets[dag_start[c+1]-1]). The
+ *  reachability bitsets are only built by the first reachability query.
+ */
+typedef struct scc {
+	int vertices_number;
+	int components_number;
+	int * component;
+	int * component_size;
+	int * dag_start;
+	int * dag_targets;
+	int words_number;
+	unsigned long long * reachable;
+} scc, *Pscc;
+
+/**
+ * This function computes the strongly connected components of a graph G
+ * with an iterative Tarjan algorithm. An undirected graph gives its connected
+ * components.
+ * @param  g The graph G.
+ * @return   The strongly connected components of G.
+ */
+Pscc new_scc(Pgraph g);
+
+/**
+ * This function returns the component of a vertex.
+ * @param  s The strongly connected components.
+ * @param  v The vertex.
+ * @return   The label of the component of v.
+ */
+int scc_component(Pscc s, int v);
+
+/**
+ * This function tests if two vertices are strongly connected.
+ * @param  s The strongly connected components.
+ * @param  x The first vertex.
+ * @param  y The second vertex.
+ * @return   1 if true, otherwise 0.
+ */
+int scc_strongly_connected(Pscc s, int x, int y);
+
+/**
+ * This function tests if there is a path from x to y (a vertex reaches
+ * itself).
+ * @param  s The strongly connected components.
+ * @param  x The first vertex.
+ * @param  y The second vertex.
+ * @return   1 if true, otherwise 0.
+ */
+int scc_reachable(Pscc s, int x, int y);
+
+/**
+ * This function returns the condensation of the graph : a directed graph with
+ * a vertex by component and an edge between two components if an edge of the
+ * graph links them.
+ * @param  s The strongly connected components.
+ * @return   The condensation.
+ */
+Pgraph scc_condensation(Pscc s);
+
+/**
+ * This function frees the strongly connected components.
+ * @param  s The strongly connected components.
+ * @return   A null pointer.
+ */
+Pscc free_scc(Pscc s);
+
+#endif
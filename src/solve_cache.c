@@ -0,0 +1,203 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "include.h"
+#include "solve_cache.h"
+#include "heuristic.h"
+#include "random_graph.h"
+#include "rng.h"
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#define FINGERPRINT_HIGH_SEED 0x8c5f0e1d2b3a4958ULL
+#define FINGERPRINT_LOW_SEED 0x1f2e3d4c5b6a7988ULL
+
+fingerprint graph_fingerprint(Pgraph g){
+	int** am = g->adjacency_matrix;
+	int n = g->vertices_number;
+	unsigned long long key;
+	unsigned long long m = 0;
+	int i,j;
+	fingerprint f;
+
+	f.high = 0;
+	f.low = 0;
+
+	/* the sum is commutative : the order of the edges does not matter */
+	for (i = 0; i < n; i++){
+		for (j = i+1; j < n; j++){
+			if (am[i][j] || am[j][i]){
+				key = ((unsigned long long)i << 32) | (unsigned int)j;
+				f.high += hash64(key ^ FINGERPRINT_HIGH_SEED);
+				f.low += hash64(key ^ FINGERPRINT_LOW_SEED);
+				m++;
+			}
+		}
+	}
+
+	f.high = hash64(f.high ^ hash64((unsigned long long)n));
+	f.low = hash64(f.low ^ hash64(m));
+
+	return f;
+}
+
+static unsigned long long hash_string(const char *s){
+	unsigned long long h = 0;
+
+	while (*s){
+		h = hash64(h ^ (unsigned char)*s++);
+	}
+
+	return h;
+}
+
+void solve_result_path(const char *cache_dir, fingerprint f, const char *solver, const char *parameters, char *path){
+	snprintf(path,SOLVE_PATH_LENGTH,"%s/%016llx%016llx-%s-v%d-%016llx.sol",cache_dir,f.high,f.low,solver,SOLVE_CACHE_VERSION,hash_string(parameters));
+}
+
+static int read_result(FILE *file, Pgraph g, Psolve_result result){
+	int** am = g->adjacency_matrix;
+	int n,m,k,i,j;
+
+	if (fscanf(file,"vertices %d\n",&n) != 1 || n != g->vertices_number
+		|| fscanf(file,"branch_vertices %d\n",&result->branch_vertices) != 1
+		|| fscanf(file,"lower_bound %d\n",&result->lower_bound) != 1
+		|| fscanf(file,"upper_bound %d\n",&result->upper_bound) != 1
+		|| fscanf(file,"time %lf\n",&result->time) != 1
+		|| fscanf(file,"edges %d\n",&m) != 1 || m != n-1){
+		return 0;
+	}
+
+	result->tree = new_graph(n);
+	for (k = 0; k < m; k++){
+		if (fscanf(file,"%d %d",&i,&j) != 2 || i < 0 || j < 0 || i >= n || j >= n
+			|| !am[i][j] || result->tree->adjacency_matrix[i][j]){
+			free_graph(result->tree);
+			result->tree = NULL;
+			return 0;
+		}
+		add_edge(result->tree,i,j);
+	}
+
+	/* n-1 edges are a spanning tree only if they connect the n vertices */
+	if (run_dfs(result->tree) != n || get_branch_vertex_number(result->tree) != result->branch_vertices){
+		free_graph(result->tree);
+		result->tree = NULL;
+		return 0;
+	}
+
+	return 1;
+}
+
+/* the first lines must be exactly the expected ones */
+static int read_header_line(FILE *file, const char *name, const char *value){
+	char line[SOLVE_PATH_LENGTH+64];
+	char expected[SOLVE_PATH_LENGTH+64];
+
+	snprintf(expected,sizeof(expected),"%s %s\n",name,value);
+
+	return fgets(line,sizeof(line),file) != NULL && strcmp(line,expected) == 0;
+}
+
+int load_solve_result(const char *cache_dir, Pgraph g, const char *solver, const char *parameters, Psolve_result result){
+	char path[SOLVE_PATH_LENGTH];
+	char version[16];
+	FILE *file;
+	int hit;
+
+	solve_result_path(cache_dir,graph_fingerprint(g),solver,parameters,path);
+	file = fopen(path,"r");
+	if (file == NULL){
+		return 0;
+	}
+
+	snprintf(version,sizeof(version),"%d",SOLVE_CACHE_VERSION);
+	hit = read_header_line(file,"version",version)
+		&& read_header_line(file,"solver",solver)
+		&& read_header_line(file,"parameters",parameters)
+		&& read_result(file,g,result);
+
+	fclose(file);
+
+	return hit;
+}
+
+int store_solve_result(const char *cache_dir, Pgraph g, const char *solver, const char *parameters, Psolve_result result){
+	char path[SOLVE_PATH_LENGTH];
+	char tmp_path[SOLVE_PATH_LENGTH+16];
+	Pgraph tree = result->tree;
+	FILE *file;
+	int i,j,error;
+
+	if (mkdir(cache_dir,0755) != 0 && errno != EEXIST){
+		return 0;
+	}
+
+	solve_result_path(cache_dir,graph_fingerprint(g),solver,parameters,path);
+	snprintf(tmp_path,sizeof(tmp_path),"%s.tmp",path);
+	file = fopen(tmp_path,"w");
+	if (file == NULL){
+		return 0;
+	}
+
+	fprintf(file,"version %d\n",SOLVE_CACHE_VERSION);
+	fprintf(file,"solver %s\n",solver);
+	fprintf(file,"parameters %s\n",parameters);
+	fprintf(file,"vertices %d\n",tree->vertices_number);
+	fprintf(file,"branch_vertices %d\n",result->branch_vertices);
+	fprintf(file,"lower_bound %d\n",result->lower_bound);
+	fprintf(file,"upper_bound %d\n",result->upper_bound);
+	fprintf(file,"time %f\n",result->time);
+	fprintf(file,"edges %d\n",tree->edges_number);
+	for (i = 0; i < tree->vertices_number; i++){
+		for (j = i+1; j < tree->vertices_number; j++){
+			if (tree->adjacency_matrix[i][j]){
+				fprintf(file,"%d %d\n",i,j);
+			}
+		}
+	}
+
+	error = fclose(file) != 0;
+	if (error || rename(tmp_path,path) != 0){
+		remove(tmp_path);
+		return 0;
+	}
+
+	return 1;
+}
+
+int cached_MBVST(const char *cache_dir, Pgraph g, Psolve_result result){
+	clock_t start;
+
+	if (load_solve_result(cache_dir,g,"mbvst","",result)){
+		return 1;
+	}
+
+	start = clock();
+	result->tree = MBVST_graph(g);
+	result->time = (double)(clock() - start) / CLOCKS_PER_SEC;
+	result->branch_vertices = get_branch_vertex_number(result->tree);
+	result->lower_bound = get_branch_vertex_lower_bound(g);
+	result->upper_bound = result->branch_vertices;
+	store_solve_result(cache_dir,g,"mbvst","",result);
+
+	return 0;
+}
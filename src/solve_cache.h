@@ -0,0 +1,120 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+/** @file solve_cache.h
+ *
+ * @brief This file manages a cache of the results of the solvers on disk.
+ *
+ * A result is stored in a text file named after the fingerprint of the graph,
+ * the name of the solver, the version of the solvers and a hash of its
+ * parameters. The file holds the
+ * tree found, its number of branch vertices, the bounds known on the optimum
+ * and the time the solver took.
+ */
+
+#ifndef SOLVE__CACHE__H
+#define SOLVE__CACHE__H
+
+#include "include.h"
+#include "graph.h"
+
+#define SOLVE_PATH_LENGTH 1024
+
+/* to increase whenever a solver changes its output on a graph. 2 : MBVST
+   cuts the whole graph again and returns the cut of Boost among ties */
+#define SOLVE_CACHE_VERSION 2
+
+/**
+ * \struct fingerprint
+ * \brief 128 bits hash of a graph
+ */
+typedef struct fingerprint {
+	unsigned long long high;
+	unsigned long long low;
+} fingerprint;
+
+/**
+ * \struct solve_result
+ * \brief result of a solver
+ *
+ * \a The optimal number of branch vertices lies in [lower_bound, upper_bound],
+ *  the time is in seconds.
+ */
+typedef struct solve_result {
+	Pgraph tree;
+	int branch_vertices;
+	int lower_bound;
+	int upper_bound;
+	double time;
+} solve_result, *Psolve_result;
+
+/**
+ * This function returns the fingerprint of an undirected graph G : a sum of
+ * hashes of its edges, so it does not depend on the order of the edges.
+ * @param  g The graph G.
+ * @return   The fingerprint of G.
+ */
+fingerprint graph_fingerprint(Pgraph g);
+
+/**
+ * This function writes the path of the file of a result.
+ * @param cache_dir  The cache directory.
+ * @param f          The fingerprint of the graph.
+ * @param solver     The name of the solver (letters, digits and '_').
+ * @param parameters The parameters of the solver.
+ * @param path       The path, at least SOLVE_PATH_LENGTH characters.
+ */
+void solve_result_path(const char *cache_dir, fingerprint f, const char *solver, const char *parameters, char *path);
+
+/**
+ * This function reads a result from the cache. The tree read must be a
+ * spanning tree made of edges of G, with the number of branch vertices
+ * stored, otherwise the result is a miss.
+ * @param  cache_dir  The cache directory.
+ * @param  g          The graph G.
+ * @param  solver     The name of the solver.
+ * @param  parameters The parameters of the solver.
+ * @param  result     The result, its tree is a new graph.
+ * @return            1 if the result was in the cache, 0 otherwise.
+ */
+int load_solve_result(const char *cache_dir, Pgraph g, const char *solver, const char *parameters, Psolve_result result);
+
+/**
+ * This function writes a result in the cache.
+ * @param  cache_dir  The cache directory, created if needed.
+ * @param  g          The graph G.
+ * @param  solver     The name of the solver.
+ * @param  parameters The parameters of the solver.
+ * @param  result     The result.
+ * @return            1 if success, 0 otherwise.
+ */
+int store_solve_result(const char *cache_dir, Pgraph g, const char *solver, const char *parameters, Psolve_result result);
+
+/**
+ * This function solves G with MBVST, or reads the result from the cache if
+ * G was already solved. The time is the one of the first solve.
+ * @param  cache_dir The cache directory.
+ * @param  g         The graph G.
+ * @param  result    The result, its tree is a new graph.
+ * @return           1 if the result was in the cache, 0 otherwise.
+ */
+int cached_MBVST(const char *cache_dir, Pgraph g, Psolve_result result);
+
+#endif
@@ -0,0 +1,143 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+#include "include.h"
+#include "spanning_tree.h"
+
+Pspanning_tree new_spanning_tree(int n){
+	int v;
+	Pspanning_tree t = (spanning_tree*) malloc(sizeof(spanning_tree));
+
+	if (t == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	t->vertices_number = n;
+	t->edges_number = 0;
+	t->branch_vertices_number = 0;
+	t->edges = (int*) malloc((2*n+1)*sizeof(int));
+	t->degree = (int*) calloc(n+1,sizeof(int));
+	t->parent = (int*) malloc((n+1)*sizeof(int));
+	t->rank = (int*) calloc(n+1,sizeof(int));
+
+	if (t->edges == NULL || t->degree == NULL || t->parent == NULL || t->rank == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	for (v = 0; v < n; v++){
+		t->parent[v] = v;
+	}
+
+	return t;
+}
+
+Pspanning_tree copy_spanning_tree(Pspanning_tree t){
+	int n = t->vertices_number;
+	Pspanning_tree c = new_spanning_tree(n);
+
+	c->edges_number = t->edges_number;
+	c->branch_vertices_number = t->branch_vertices_number;
+	memcpy(c->edges,t->edges,2*t->edges_number*sizeof(int));
+	memcpy(c->degree,t->degree,n*sizeof(int));
+	memcpy(c->parent,t->parent,n*sizeof(int));
+	memcpy(c->rank,t->rank,n*sizeof(int));
+
+	return c;
+}
+
+Pspanning_tree graph_to_spanning_tree(Pgraph g){
+	int i,j;
+	int n = g->vertices_number;
+	Pspanning_tree t = new_spanning_tree(n);
+
+	for (i = 0; i < n; i++){
+		for (j = i+1; j < n; j++){
+			if (g->adjacency_matrix[i][j]){
+				spanning_tree_add_edge(t,i,j);
+			}
+		}
+	}
+
+	return t;
+}
+
+Pgraph spanning_tree_to_graph(Pspanning_tree t){
+	int k;
+	Pgraph g = new_graph(t->vertices_number);
+
+	for (k = 0; k < t->edges_number; k++){
+		add_edge(g,t->edges[2*k],t->edges[2*k+1]);
+	}
+
+	return g;
+}
+
+int spanning_tree_component(Pspanning_tree t, int v){
+	while (t->parent[v] != v){
+		t->parent[v] = t->parent[t->parent[v]];
+		v = t->parent[v];
+	}
+
+	return v;
+}
+
+int spanning_tree_connected(Pspanning_tree t, int u, int v){
+	return spanning_tree_component(t,u) == spanning_tree_component(t,v);
+}
+
+int spanning_tree_add_edge(Pspanning_tree t, int u, int v){
+	int a = spanning_tree_component(t,u);
+	int b = spanning_tree_component(t,v);
+
+	if (a == b){
+		return 0;
+	}
+
+	/* union by rank */
+	if (t->rank[a] < t->rank[b]){
+		t->parent[a] = b;
+	}
+	else{
+		t->parent[b] = a;
+		if (t->rank[a] == t->rank[b]){
+			t->rank[a]++;
+		}
+	}
+
+	t->edges[2*t->edges_number] = u;
+	t->edges[2*t->edges_number+1] = v;
+	t->edges_number++;
+
+	/* a vertex becomes a branch vertex when its degree reaches 3 */
+	t->branch_vertices_number += ++t->degree[u] == 3;
+	t->branch_vertices_number += ++t->degree[v] == 3;
+
+	return 1;
+}
+
+Pspanning_tree free_spanning_tree(Pspanning_tree t){
+	free(t->edges);
+	free(t->degree);
+	free(t->parent);
+	free(t->rank);
+	free(t);
+
+	return NULL;
+}
@@ -0,0 +1,117 @@
+/*
+
+Copyright (c) 2019-2020, Adrien BLASSIAU
+
+Permission to use, copy, modify, and/or distribute this software
+for any purpose with or without fee is hereby granted, provided
+that the above copyright notice and this permission notice appear
+in all copies.
+
+THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+*/
+
+/** @file spanning_tree.h
+ *
+ * @brief This file manages the spanning trees built by the heuristics.
+ *
+ * A spanning tree (or forest) is stored as the list of its edges with the
+ * degree of every vertex, the number of branch vertices (degree greater than
+ * 2) and a union-find of its components, all kept up to date when an edge is
+ * added. Degrees and branch vertices are read in O(1), components in
+ * O(alpha(n)), and the whole tree takes O(n) memory.
+ */
+
+#ifndef SPANNING__TREE__H
+#define SPANNING__TREE__H
+
+#include "include.h"
+#include "graph.h"
+
+/**
+ * \struct spanning_tree
+ * \brief spanning tree structure
+ *
+ * \a The k-th edge links edges[2k] and edges[2k+1]. parent and rank form the
+ *  union-find of the components.
+ */
+typedef struct spanning_tree {
+	int vertices_number;
+	int edges_number;
+	int branch_vertices_number;
+	int * edges;
+	int * degree;
+	int * parent;
+	int * rank;
+} spanning_tree, *Pspanning_tree;
+
+/**
+ * This function creates a spanning forest without edges.
+ * @param  n The number of vertices.
+ * @return   The forest.
+ */
+Pspanning_tree new_spanning_tree(int n);
+
+/**
+ * This function returns a copy of a spanning forest.
+ * @param  t The forest.
+ * @return   The copy.
+ */
+Pspanning_tree copy_spanning_tree(Pspanning_tree t);
+
+/**
+ * This function creates a spanning forest from the edges of a graph G. An
+ * edge closing a cycle is ignored.
+ * @param  g The graph G.
+ * @return   The forest.
+ */
+Pspanning_tree graph_to_spanning_tree(Pgraph g);
+
+/**
+ * This function returns a spanning tree as a graph.
+ * @param  t The spanning tree.
+ * @return   The graph of its edges.
+ */
+Pgraph spanning_tree_to_graph(Pspanning_tree t);
+
+/**
+ * This function adds an edge between two components of a spanning forest.
+ * @param  t The forest.
+ * @param  u The first vertex.
+ * @param  v The second vertex.
+ * @return   1 if the edge is added, 0 if u and v are already connected.
+ */
+int spanning_tree_add_edge(Pspanning_tree t, int u, int v);
+
+/**
+ * This function returns the component of a vertex.
+ * @param  t The forest.
+ * @param  v The vertex.
+ * @return   The representative of the component of v.
+ */
+int spanning_tree_component(Pspanning_tree t, int v);
+
+/**
+ * This function tests if two vertices are in the same component.
+ * @param  t The forest.
+ * @param  u The first vertex.
+ * @param  v The second vertex.
+ * @return   1 if true, 0 otherwise.
+ */
+int spanning_tree_connected(Pspanning_tree t, int u, int v);
+
+/**
+ * This function frees a spanning forest.
+ * @param  t The forest.
+ * @return   A null pointer.
+ */
+Pspanning_tree free_spanning_tree(Pspanning_tree t);
+
+#endif
@@ -74,4 +74,14 @@ int free_matrix(int** m, int size){
 	free(m);
 
 	return 1;
-}
\ No newline at end of file
+}
+
+void* allocate(size_t size){
+	void *p = malloc(size);
+
+	if (p == NULL){
+		exit(EXIT_FAILURE);
+	}
+
+	return p;
+}
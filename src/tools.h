@@ -62,4 +62,11 @@ int allocate_matrix(int*** m, int size1, int size2);
  */
 int free_matrix(int** m, int size);
 
+/**
+ * This function allocates a block in the heap, the program exits if it fails.
+ * @param  size The size of the block.
+ * @return      The block.
+ */
+void* allocate(size_t size);
+
 #endif
@@ -27,6 +27,34 @@ CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 #include "../src/tools.h"
 #include "../src/random_graph.h"
 #include "../src/heuristic.h"
+#include "../src/edge_table.h"
+#include "../src/dynamic_connectivity.h"
+#include "../src/rng.h"
+#include "../src/graph_io.h"
+#include "../src/instance_generator.h"
+#include "../src/instance_cache.h"
+#include "../src/scc.h"
+#include "../src/block_decomposition.h"
+#include "../src/external_graph.h"
+#include "../src/solve_cache.h"
+#include "../src/bridges.h"
+#include "../src/bgl_graph.h"
+#include "../src/min_cut.h"
+#include "../src/incidence.h"
+#include "../src/spanning_tree.h"
+#include "../src/multi_start.h"
+#include "../src/link_cut_tree.h"
+#include "../src/local_search.h"
+#include "../src/anytime.h"
+#include "../src/constructive.h"
+#include "../src/engine.h"
+
+#include <boost/thread/thread.hpp>
+
+#define TEST_GRAPH_FILE "test_graph.tmp"
+#define TEST_CACHE_DIR "test_cache.tmp"
+#define TEST_SORTED_FILE "test_sorted.tmp"
+#define TEST_RESULT_DIR "test_results.tmp"
 
 int setup(void)  { return 0; }
 int teardown(void) { return 0; }
@@ -47,9 +75,13 @@ int init_test(void){
 		( NULL == CU_add_test(pSuite, "Test dfs", test_dfs)) ||
 		( NULL == CU_add_test(pSuite, "Test if G is connected", test_if_connected)) ||
 		( NULL == CU_add_test(pSuite, "Test random graph", test_random_graph)) ||
+		( NULL == CU_add_test(pSuite, "Test repair connectivity", test_repair_connectivity)) ||
+		( NULL == CU_add_test(pSuite, "Test random connected graph", test_random_connected_graph)) ||
+		( NULL == CU_add_test(pSuite, "Test remove random edges", test_remove_random_edges)) ||
 		( NULL == CU_add_test(pSuite, "Test vertex degree", test_vertex_degree)) ||
 		( NULL == CU_add_test(pSuite, "Test number connected components", test_number_connected_components)) ||
 		( NULL == CU_add_test(pSuite, "Test get vertex type", test_get_vertex_type)) ||
+		( NULL == CU_add_test(pSuite, "Test get vertices type list", test_get_vertices_type_list)) ||
 		( NULL == CU_add_test(pSuite, "Test vertices type list", test_vertices_type_list)) ||
 		( NULL == CU_add_test(pSuite, "Test edges list", test_edges_list)) ||
 		( NULL == CU_add_test(pSuite, "Test add edge", test_add_edge)) ||
@@ -63,7 +95,44 @@ int init_test(void){
 		( NULL == CU_add_test(pSuite, "Test saturer", test_saturer)) ||
 		( NULL == CU_add_test(pSuite, "Test departager", test_departager)) ||
 		( NULL == CU_add_test(pSuite, "Test modify weight list", test_modify_weight_list)) ||
-		( NULL == CU_add_test(pSuite, "Test changer type", test_changer_type)))
+		( NULL == CU_add_test(pSuite, "Test changer type", test_changer_type)) ||
+		( NULL == CU_add_test(pSuite, "Test MBVST fast", test_MBVST_fast)) ||
+		( NULL == CU_add_test(pSuite, "Test MBVST workspace", test_mbvst_workspace)) ||
+		( NULL == CU_add_test(pSuite, "Test MBVST edge sequence", test_mbvst_edge_sequence)) ||
+		( NULL == CU_add_test(pSuite, "Test edge table", test_edge_table)) ||
+		( NULL == CU_add_test(pSuite, "Test dynamic connectivity", test_dynamic_connectivity)) ||
+		( NULL == CU_add_test(pSuite, "Test dynamic connectivity random", test_dynamic_connectivity_random)) ||
+		( NULL == CU_add_test(pSuite, "Test rng", test_rng)) ||
+		( NULL == CU_add_test(pSuite, "Test rng reproducible graphs", test_rng_reproducible_graphs)) ||
+		( NULL == CU_add_test(pSuite, "Test edge sampler", test_edge_sampler)) ||
+		( NULL == CU_add_test(pSuite, "Test graph io", test_graph_io)) ||
+		( NULL == CU_add_test(pSuite, "Test geometric graph", test_geometric_graph)) ||
+		( NULL == CU_add_test(pSuite, "Test barabasi albert graph", test_barabasi_albert_graph)) ||
+		( NULL == CU_add_test(pSuite, "Test watts strogatz graph", test_watts_strogatz_graph)) ||
+		( NULL == CU_add_test(pSuite, "Test grid graph", test_grid_graph)) ||
+		( NULL == CU_add_test(pSuite, "Test random regular graph", test_random_regular_graph)) ||
+		( NULL == CU_add_test(pSuite, "Test planted graph", test_planted_graph)) ||
+		( NULL == CU_add_test(pSuite, "Test instance cache", test_instance_cache)) ||
+		( NULL == CU_add_test(pSuite, "Test scc", test_scc)) ||
+		( NULL == CU_add_test(pSuite, "Test scc random", test_scc_random)) ||
+		( NULL == CU_add_test(pSuite, "Test block cut tree", test_block_cut_tree)) ||
+		( NULL == CU_add_test(pSuite, "Test solve by blocks", test_solve_by_blocks)) ||
+		( NULL == CU_add_test(pSuite, "Test sort graph file", test_sort_graph_file)) ||
+		( NULL == CU_add_test(pSuite, "Test external repair", test_external_repair)) ||
+		( NULL == CU_add_test(pSuite, "Test graph fingerprint", test_graph_fingerprint)) ||
+		( NULL == CU_add_test(pSuite, "Test solve cache", test_solve_cache)) ||
+		( NULL == CU_add_test(pSuite, "Test bridge set", test_bridge_set)) ||
+		( NULL == CU_add_test(pSuite, "Test bridge set random", test_bridge_set_random)) ||
+		( NULL == CU_add_test(pSuite, "Test bgl graph", test_bgl_graph)) ||
+		( NULL == CU_add_test(pSuite, "Test min cut", test_min_cut)) ||
+		( NULL == CU_add_test(pSuite, "Test incidence", test_incidence)) ||
+		( NULL == CU_add_test(pSuite, "Test spanning tree", test_spanning_tree)) ||
+		( NULL == CU_add_test(pSuite, "Test multi start", test_multi_start)) ||
+		( NULL == CU_add_test(pSuite, "Test link cut tree", test_link_cut_tree)) ||
+		( NULL == CU_add_test(pSuite, "Test local search", test_local_search)) ||
+		( NULL == CU_add_test(pSuite, "Test MBVST with budget", test_MBVST_with_budget)) ||
+		( NULL == CU_add_test(pSuite, "Test constructive", test_constructive)) ||
+		( NULL == CU_add_test(pSuite, "Test engine", test_engine)))
 	{
 		CU_cleanup_registry();
 		return CU_get_error();
@@ -76,6 +145,45 @@ int init_test(void){
 	return 0;
 }
 
+/* ########################################################## */
+/* ###################### TEST HELPERS ###################### */
+/* ########################################################## */
+
+/* a random connected graph of n vertices with the density of the benchmark,
+   or a tree when the formula asks for more edges than the complete graph */
+static Pgraph random_test_graph(int n, Prng r){
+	int density = compute_density_formula(n);
+
+	return generate_random_connected_graph(n,density < n*(n-1)/2 ? density : n-1,r);
+}
+
+/* 1 if the tree is a spanning forest of G with components_number trees and
+   the counters of the tree are right */
+static int is_cover_forest(Pgraph g, Pspanning_tree tree, int components_number){
+	int i,v,ok;
+	Pgraph tree_graph = spanning_tree_to_graph(tree);
+	int **reach;
+
+	ok = tree->edges_number == g->vertices_number - components_number;
+	for (i = 0; i < tree->edges_number; i++){
+		ok = ok && g->adjacency_matrix[tree->edges[2*i]][tree->edges[2*i+1]];
+	}
+	for (v = 0; v < g->vertices_number; v++){
+		ok = ok && tree->degree[v] == get_vertex_degree(tree_graph,v);
+	}
+	ok = ok && tree->branch_vertices_number == get_branch_vertex_number(tree_graph);
+
+	/* the same components as G */
+	reach = connected_components_vertices(tree_graph);
+	for (v = 1; v < g->vertices_number && components_number == 1; v++){
+		ok = ok && reach[v][1] == reach[0][1];
+	}
+	free_matrix(reach,g->vertices_number);
+	free_graph(tree_graph);
+
+	return ok;
+}
+
 /* ########################################################## */
 /* #################### GRAPH.C TESTS ####################### */
 /* ########################################################## */
@@ -694,11 +802,12 @@ void test_roy_warshall(void)
 
 void test_dfs(void)
 {
-	srand(time(NULL));
+	rng r;
+	init_rng(&r,time(NULL),0);
 
 	int size = 10;
 	int density = 9;
-	Pgraph g = generate_random_graph(size,density,1);
+	Pgraph g = generate_random_graph(size,density,1,&r);
 
 	test_connected(g);
 	CU_ASSERT_EQUAL(run_dfs(g),10);
@@ -728,17 +837,36 @@ void test_if_connected(void)
 	CU_ASSERT_EQUAL(test_connected(g),0);
 
 	free_graph(g);
+
+	/* a single vertex is connected */
+	g = new_graph(1);
+	CU_ASSERT_EQUAL(test_connected(g),1);
+	free_graph(g);
+
+	/* a directed graph must be strongly connected : 2 and 3 do not reach 0 */
+	int m3[4][4] = {{0,1,0,0},{1,0,1,0},{0,0,0,1},{0,0,1,0}};
+	g = new_graph(size);
+	fill_graph(g,m3,1);
+	CU_ASSERT_EQUAL(test_connected(g),0);
+	free_graph(g);
+
+	int m4[4][4] = {{0,1,0,0},{0,0,1,0},{0,0,0,1},{1,0,0,0}};
+	g = new_graph(size);
+	fill_graph(g,m4,1);
+	CU_ASSERT_EQUAL(test_connected(g),1);
+	free_graph(g);
 }
 
 void test_random_graph(void)
 {
-	srand(time(NULL));
+	rng r;
+	init_rng(&r,time(NULL),0);
 
 	int i,j;
 	int size = 10;
 	int density = 9;
 	int edge_number = 0;
-	Pgraph g = generate_random_graph(size,density,1);
+	Pgraph g = generate_random_graph(size,density,1,&r);
 
 	test_connected(g);
 	CU_ASSERT_EQUAL(test_connected(g),1);
@@ -760,6 +888,155 @@ void test_random_graph(void)
 	free_graph(g);
 }
 
+void test_repair_connectivity(void)
+{
+	int i;
+	int size = 9;
+	/*
+	 * 0-1 3-4 6-7
+	 * |/. |/. |/.
+	 * 2.. 5.. 8..
+	 *
+	 */
+	int m[9][9] = {
+		{0,1,1,0,0,0,0,0,0},
+		{1,0,1,0,0,0,0,0,0},
+		{1,1,0,0,0,0,0,0,0},
+		{0,0,0,0,1,1,0,0,0},
+		{0,0,0,1,0,1,0,0,0},
+		{0,0,0,1,1,0,0,0,0},
+		{0,0,0,0,0,0,0,1,1},
+		{0,0,0,0,0,0,1,0,1},
+		{0,0,0,0,0,0,1,1,0}};
+
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	/* one dfs, then the graph is connected with the same number of edges */
+	for (i = 0; i < 20; i++){
+		Pgraph g = new_graph(size);
+		fill_graph(g,m,0);
+
+		CU_ASSERT_EQUAL(repair_connectivity(g,&r),1);
+		CU_ASSERT_EQUAL(test_connected(g),1);
+		CU_ASSERT_EQUAL(g->edges_number,9);
+		CU_ASSERT_EQUAL(get_vertices_degree_sum(g),18);
+
+		free_graph(g);
+	}
+
+	/* no traversal at all with the dynamic connectivity structure */
+	Pgraph g = new_graph(size);
+	fill_graph(g,m,0);
+	attach_connectivity(g);
+
+	CU_ASSERT_EQUAL(repair_connectivity(g,&r),0);
+	CU_ASSERT_EQUAL(test_connected(g),1);
+	CU_ASSERT_EQUAL(g->edges_number,9);
+	CU_ASSERT_EQUAL(connectivity_components_number(g->connectivity),1);
+
+	free_graph(g);
+
+	/* a connected graph is left untouched */
+	g = new_graph(size);
+	fill_graph(g,m,0);
+	add_edge(g,2,3);
+	add_edge(g,5,6);
+
+	CU_ASSERT_EQUAL(repair_connectivity(g,&r),1);
+	CU_ASSERT_EQUAL(g->edges_number,11);
+	CU_ASSERT_EQUAL(g->adjacency_matrix[2][3],1);
+	CU_ASSERT_EQUAL(g->adjacency_matrix[5][6],1);
+
+	free_graph(g);
+}
+
+void test_random_connected_graph(void)
+{
+	int i,size,density;
+	int tab_size[5] = {1,2,3,10,100};
+	int **edges_list;
+	Pgraph g;
+	rng r;
+
+	init_rng(&r,time(NULL),0);
+
+	for (i = 0; i < 5; i++){
+		size = tab_size[i];
+		density = size < 4 ? size*(size-1)/2 : compute_density_formula(size);
+
+		g = generate_random_connected_graph(size,density,&r);
+
+		CU_ASSERT_EQUAL(run_dfs(g),size);
+		CU_ASSERT_EQUAL(g->edges_number,density);
+		/* no duplicated edge and no loop */
+		CU_ASSERT_EQUAL(get_vertices_degree_sum(g),2*density);
+
+		free_graph(g);
+	}
+
+	/* the first size-1 edges are a spanning tree */
+	size = 50;
+	edges_list = generate_random_connected_edges_list(size,200,&r);
+	g = new_graph(size);
+	for (i = 0; i < size-1; i++){
+		add_edge(g,edges_list[i][0],edges_list[i][1]);
+	}
+	CU_ASSERT_EQUAL(run_dfs(g),size);
+	free_graph(g);
+	free_matrix(edges_list,200);
+
+	/* a complete graph is reachable, more edges are not */
+	g = generate_random_connected_graph(6,15,&r);
+	CU_ASSERT_EQUAL(get_vertices_degree_sum(g),30);
+	free_graph(g);
+
+	CU_ASSERT_PTR_NULL(generate_random_connected_graph(6,16,&r));
+	CU_ASSERT_PTR_NULL(generate_random_connected_edges_list(6,4,&r));
+}
+
+void test_remove_random_edges(void)
+{
+	int size = 200;
+	int density = 4*size;
+	int i, added;
+	Pgraph g;
+	rng r;
+
+	init_rng(&r,time(NULL),0);
+
+	g = generate_random_connected_graph(size,density,&r);
+	CU_ASSERT_EQUAL(remove_random_edges(g,300,0,&r),1);
+	CU_ASSERT_EQUAL(g->edges_number,density-300);
+	CU_ASSERT_EQUAL(get_vertices_degree_sum(g),2*(density-300));
+	free_graph(g);
+
+	/* every non-bridge can go, the graph ends as a spanning tree */
+	g = generate_random_connected_graph(size,density,&r);
+	CU_ASSERT_EQUAL(remove_random_edges(g,density-size+1,1,&r),1);
+	CU_ASSERT_EQUAL(g->edges_number,size-1);
+	CU_ASSERT_EQUAL(run_dfs(g),size);
+	CU_ASSERT_PTR_NULL(g->connectivity);
+	CU_ASSERT_EQUAL(remove_random_edges(g,1,1,&r),0);
+	CU_ASSERT_EQUAL(g->edges_number,size-1);
+
+	/* the sampler of G is kept and follows the changes of G */
+	CU_ASSERT_PTR_NOT_NULL(g->sampler);
+	for (i = 1, added = 0; added < 2; i++){
+		if (!g->adjacency_matrix[0][i]){
+			add_edge(g,0,i);
+			added++;
+		}
+	}
+	CU_ASSERT_EQUAL(g->sampler->edges_number,g->edges_number);
+	CU_ASSERT_EQUAL(remove_random_edges(g,2,0,&r),1);
+	CU_ASSERT_EQUAL(g->edges_number,size-1);
+	CU_ASSERT_EQUAL(g->sampler->edges_number,size-1);
+	clean_graph(g);
+	CU_ASSERT_EQUAL(remove_random_edges(g,1,0,&r),0);
+	free_graph(g);
+}
+
 void test_number_connected_components(void)
 {
 	int size = 5;
@@ -980,6 +1257,37 @@ void test_get_vertex_type(void)
 	free_graph(g);
 }
 
+void test_get_vertices_type_list(void){
+	int k,u,v,n,m,wrong;
+	int *vertices_type_list;
+	Pgraph g;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	/* the blocks give the same types as one DFS per vertex */
+	wrong = 0;
+	for (k = 0; k < 40; k++){
+		n = 1 + rng_uniform(&r,40);
+		m = n - 2 + rng_uniform(&r,n);
+		m = m < n*(n-1)/2 ? m : n*(n-1)/2;
+		g = new_graph(n);
+		while (g->edges_number < m){
+			u = rng_uniform(&r,n);
+			v = rng_uniform(&r,n);
+			if (u != v && !g->adjacency_matrix[u][v]){
+				add_edge(g,u,v);
+			}
+		}
+		vertices_type_list = get_vertices_type_list(g);
+		for (v = 0; v < n; v++){
+			wrong += vertices_type_list[v] != get_vertex_type(g,v);
+		}
+		free(vertices_type_list);
+		free_graph(g);
+	}
+	CU_ASSERT_EQUAL(wrong,0);
+}
+
 void test_vertices_type_list(void)
 {
 	int size = 5;
@@ -1349,6 +1657,17 @@ void test_modify_weight_list(void){
 	CU_ASSERT_EQUAL(weight_list[5],2);
 	CU_ASSERT_EQUAL(weight_list[6],1);
 
+	/* the same with the incident edges */
+	Pincidence in = new_incidence(edges_list,size,size2);
+	modify_incident_weight_list(3,weight_list,in,-1);
+
+	CU_ASSERT_EQUAL(weight_list[0],1);
+	CU_ASSERT_EQUAL(weight_list[1],1);
+	CU_ASSERT_EQUAL(weight_list[3],1);
+	CU_ASSERT_EQUAL(weight_list[4],1);
+	CU_ASSERT_EQUAL(weight_list[5],1);
+
+	free_incidence(in);
 	free_matrix(edges_list,size2);
 	free(weight_list);
 	free_graph(g);
@@ -1462,12 +1781,14 @@ void test_saturer(void){
 
 	Pgraph g = new_graph(size1);
 	fill_graph(g,m,0);
-	Pgraph tree = new_graph(size1);
+	Pspanning_tree tree = new_spanning_tree(size1);
 	int v = 3;
 	int *vertices_type_list = get_vertices_type_list(g);
 	int *weight_list = get_weight_list(g);
+	int **edges_list = get_edges_list(g);
+	Pincidence in = new_incidence(edges_list,size1,g->edges_number);
 
-	saturer(g,tree,v,vertices_type_list,weight_list);
+	saturer(tree,v,vertices_type_list,weight_list,edges_list,in);
 
 	CU_ASSERT_EQUAL(weight_list[0],1);
 	CU_ASSERT_EQUAL(weight_list[1],1000);
@@ -1476,9 +1797,11 @@ void test_saturer(void){
 	CU_ASSERT_EQUAL(weight_list[4],1000);
 	CU_ASSERT_EQUAL(weight_list[5],1000);
 
+	free_incidence(in);
+	free_matrix(edges_list,g->edges_number);
 	free(vertices_type_list);
 	free(weight_list);
-	free_graph(tree);
+	free_spanning_tree(tree);
 	free_graph(g);
 }
 
@@ -1523,8 +1846,9 @@ void test_departager(void){
 		{0,0,0,1,0,0},
 		{0,0,0,1,0,0}};
 
-	Pgraph tree = new_graph(size1);
-	fill_graph(tree,m2,0);
+	Pgraph tree_graph = new_graph(size1);
+	fill_graph(tree_graph,m2,0);
+	Pspanning_tree tree = graph_to_spanning_tree(tree_graph);
 
 	int* cut_list = (int *)calloc(size,sizeof(int));
 
@@ -1554,7 +1878,8 @@ void test_departager(void){
 
 	free_matrix(edges_list,size);
 	free(cut_list);
-	free_graph(tree);
+	free_spanning_tree(tree);
+	free_graph(tree_graph);
 	free_graph(g);
 
 }
@@ -1601,10 +1926,13 @@ void test_changer_type(void){
 		{0,0,1,0,0,1},
 		{0,0,1,0,1,0}};
 
-	Pgraph tree = new_graph(size1);
-	fill_graph(tree,m2,0);
+	Pgraph tree_graph = new_graph(size1);
+	fill_graph(tree_graph,m2,0);
+	Pspanning_tree tree = graph_to_spanning_tree(tree_graph);
 
-	changer_type(g,tree,3,vertices_type_list,weight_list,edges_list,size);
+	Pincidence in = new_incidence(edges_list,size1,size);
+
+	changer_type(tree,3,vertices_type_list,weight_list,edges_list,in);
 
 	CU_ASSERT_EQUAL(vertices_type_list[3],3);
 	CU_ASSERT_EQUAL(weight_list[0],1);
@@ -1615,10 +1943,1989 @@ void test_changer_type(void){
 	CU_ASSERT_EQUAL(weight_list[5],-2);
 	CU_ASSERT_EQUAL(weight_list[6],1);
 
+	free_incidence(in);
 	free_matrix(edges_list,size);
 	free(vertices_type_list);
 	free(weight_list);
-	free_graph(tree);
+	free_spanning_tree(tree);
+	free_graph(tree_graph);
+	free_graph(g);
+
+}
+
+void test_MBVST_fast(void){
+	int k,n;
+	Pgraph g;
+	Pspanning_tree tree;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	for (k = 0; k < 20; k++){
+		n = 2 + rng_uniform(&r,200);
+		g = random_test_graph(n,&r);
+		tree = k % 4 ? MBVST_fast(g) : MBVST(g);
+
+		/* n-1 edges of G without cycle, and the counters of the tree */
+		CU_ASSERT(is_cover_forest(g,tree,1));
+
+		free_spanning_tree(tree);
+		free_graph(g);
+	}
+
+	/* a tree is its own cover tree */
+	g = generate_random_connected_graph(50,49,&r);
+	tree = MBVST_fast(g);
+	CU_ASSERT(is_cover_forest(g,tree,1));
+	free_spanning_tree(tree);
+	free_graph(g);
+}
+
+/* the allocations of the program are counted while counting_allocations is
+ * set, the memory still comes from the allocator of the glibc */
+extern "C" {
+	void *__libc_malloc(size_t size);
+	void *__libc_calloc(size_t number, size_t size);
+	void *__libc_realloc(void *p, size_t size);
+}
+
+static int counting_allocations = 0;
+static long allocations_number = 0;
+
+void *malloc(size_t size) noexcept {
+	allocations_number += counting_allocations;
+	return __libc_malloc(size);
+}
+
+void *calloc(size_t number, size_t size) noexcept {
+	allocations_number += counting_allocations;
+	return __libc_calloc(number,size);
+}
+
+void *realloc(void *p, size_t size) noexcept {
+	allocations_number += counting_allocations;
+	return __libc_realloc(p,size);
+}
+
+void test_mbvst_workspace(void){
+	int i,k,n,steps,same;
+	Pgraph g;
+	Pspanning_tree tree;
+	Pmbvst_workspace w;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	for (k = 0; k < 10; k++){
+		n = 10 + rng_uniform(&r,120);
+		g = random_test_graph(n,&r);
+		w = new_mbvst_workspace(g);
+
+		/* the iterations only write over the buffers of the workspace */
+		steps = 0;
+		allocations_number = 0;
+		counting_allocations = 1;
+		while (mbvst_step(w)){
+			steps++;
+		}
+		counting_allocations = 0;
+
+		CU_ASSERT_EQUAL(allocations_number,0);
+		CU_ASSERT_EQUAL(w->tree->edges_number,n-1);
+		CU_ASSERT(steps <= n-1);
+		CU_ASSERT_EQUAL(mbvst_step(w),0);
+
+		/* the tree of MBVST */
+		tree = MBVST(g);
+		same = tree->edges_number == w->tree->edges_number;
+		for (i = 0; same && i < 2*tree->edges_number; i++){
+			same = tree->edges[i] == w->tree->edges[i];
+		}
+		CU_ASSERT_EQUAL(same,1);
+
+		free_spanning_tree(tree);
+		free_mbvst_workspace(w);
+		free_graph(g);
+	}
+}
+
+void test_mbvst_edge_sequence(void){
+	int i,k,n,min,u,v,x,y,edges_number;
+	int *weight_list;
+	int *cut_list;
+	Pgraph g;
+	Pmbvst_workspace w;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	for (k = 0; k < 10; k++){
+		n = 10 + rng_uniform(&r,70);
+		g = random_test_graph(n,&r);
+		w = new_mbvst_workspace(g);
+		weight_list = (int *)malloc(w->edges_number*sizeof(int));
+
+		/* each step adds the edge that the cut of run_stoer_wagner gives */
+		do{
+			for (i = 0; i < w->edges_number; i++){
+				weight_list[i] = w->weight_list[i];
+			}
+			cut_list = run_stoer_wagner(weight_list,n,w->edges_list,w->edges_number);
+			min = find_min_weight_edges(cut_list,weight_list,w->edges_number);
+			x = -1;
+			y = -1;
+			if (w->tree->edges_number < n-1){
+				if (min == 3){
+					departager(w->tree,cut_list,w->edges_list,w->edges_number,&x,&y);
+				}
+				else{
+					get_first_edge(cut_list,w->edges_list,w->edges_number,&x,&y);
+				}
+			}
+			free(cut_list);
+
+			edges_number = w->tree->edges_number;
+			if (!mbvst_step(w)){
+				break;
+			}
+			u = w->tree->edges[2*edges_number];
+			v = w->tree->edges[2*edges_number+1];
+			CU_ASSERT(u == x && v == y);
+		} while (1);
+
+		CU_ASSERT_EQUAL(w->tree->edges_number,n-1);
+
+		free(weight_list);
+		free_mbvst_workspace(w);
+		free_graph(g);
+	}
+}
+
+/* ########################################################## */
+/* ################# EDGE_TABLE.C TESTS ##################### */
+/* ########################################################## */
+
+void test_edge_table(void){
+	int i;
+	Pedge_table t = new_edge_table(2);
+
+	CU_ASSERT_EQUAL(edge_table_get(t,0,1),-1);
+
+	edge_table_put(t,0,1,7);
+	edge_table_put(t,3,2,8);
+
+	CU_ASSERT_EQUAL(edge_table_get(t,0,1),7);
+	CU_ASSERT_EQUAL(edge_table_get(t,1,0),7);
+	CU_ASSERT_EQUAL(edge_table_get(t,2,3),8);
+	CU_ASSERT_EQUAL(t->size,2);
+
+	edge_table_put(t,1,0,9);
+	CU_ASSERT_EQUAL(edge_table_get(t,0,1),9);
+	CU_ASSERT_EQUAL(t->size,2);
+
+	/* the table grows and keeps every edge */
+	for (i = 0; i < 1000; i++){
+		edge_table_put(t,i,i+5,i);
+	}
+	CU_ASSERT_EQUAL(t->size,1002);
+
+	for (i = 0; i < 1000; i += 2){
+		CU_ASSERT_EQUAL(edge_table_remove(t,i+5,i),i);
+	}
+	CU_ASSERT_EQUAL(edge_table_remove(t,0,5),-1);
+	CU_ASSERT_EQUAL(t->size,502);
+
+	for (i = 0; i < 1000; i++){
+		CU_ASSERT_EQUAL(edge_table_get(t,i,i+5),i%2 ? i : -1);
+	}
+	CU_ASSERT_EQUAL(edge_table_get(t,2,3),8);
+
+	clean_edge_table(t);
+	CU_ASSERT_EQUAL(t->size,0);
+	CU_ASSERT_EQUAL(edge_table_get(t,2,3),-1);
+
+	free_edge_table(t);
+}
+
+/* ########################################################## */
+/* ############ DYNAMIC_CONNECTIVITY.C TESTS ################ */
+/* ########################################################## */
+
+void test_dynamic_connectivity(void){
+	Pconnectivity c = new_connectivity(6);
+
+	CU_ASSERT_EQUAL(connectivity_components_number(c),6);
+
+	/*
+	 * 0-1-2
+	 * |/...
+	 * 3.4-5
+	 *
+	 */
+	connectivity_add_edge(c,0,1);
+	connectivity_add_edge(c,1,2);
+	connectivity_add_edge(c,0,3);
+	connectivity_add_edge(c,1,3);
+	connectivity_add_edge(c,4,5);
+	connectivity_add_edge(c,5,4);
+
+	CU_ASSERT_EQUAL(connectivity_components_number(c),2);
+	CU_ASSERT_EQUAL(connectivity_connected(c,2,3),1);
+	CU_ASSERT_EQUAL(connectivity_connected(c,2,4),0);
+	CU_ASSERT_EQUAL(connectivity_component_size(c,3),4);
+	CU_ASSERT_EQUAL(connectivity_component_size(c,5),2);
+	CU_ASSERT_EQUAL(connectivity_representative(c,0),connectivity_representative(c,2));
+	CU_ASSERT_NOT_EQUAL(connectivity_representative(c,0),connectivity_representative(c,4));
+
+	/* 0-1 is replaced by 0-3-1 */
+	connectivity_remove_edge(c,1,0);
+	CU_ASSERT_EQUAL(connectivity_components_number(c),2);
+	CU_ASSERT_EQUAL(connectivity_connected(c,0,2),1);
+
+	/* 1-3 is a bridge now */
+	connectivity_remove_edge(c,1,3);
+	CU_ASSERT_EQUAL(connectivity_components_number(c),3);
+	CU_ASSERT_EQUAL(connectivity_connected(c,0,2),0);
+	CU_ASSERT_EQUAL(connectivity_connected(c,0,3),1);
+
+	connectivity_remove_edge(c,1,3);
+	CU_ASSERT_EQUAL(connectivity_components_number(c),3);
+
+	clean_connectivity(c);
+	CU_ASSERT_EQUAL(connectivity_components_number(c),6);
+	CU_ASSERT_EQUAL(connectivity_connected(c,4,5),0);
+
+	free_connectivity(c);
+}
+
+void test_dynamic_connectivity_random(void){
+	int i,j,x,y,number_components;
+	int size = 40;
+	int** reach;
+	Pgraph g = new_graph(size);
+	rng r;
+
+	init_rng(&r,42,0);
+	attach_connectivity(g);
+
+	/* the structure is checked against a dfs after each change */
+	for (i = 0; i < 3000; i++){
+		x = rng_uniform(&r,size);
+		y = rng_uniform(&r,size);
+
+		if (x == y){
+			continue;
+		}
+
+		if (g->adjacency_matrix[x][y]){
+			remove_edge(g,x,y);
+		}
+		else if (g->edges_number < 60){
+			add_edge(g,x,y);
+		}
+
+		reach = connected_components_vertices(g);
+		number_components = 0;
+		for (j = 0; j < size; j++){
+			if (reach[j][1] >= number_components){
+				number_components = reach[j][1]+1;
+			}
+		}
+		CU_ASSERT_EQUAL(connectivity_components_number(g->connectivity),number_components);
+		x = rng_uniform(&r,size);
+		y = rng_uniform(&r,size);
+		CU_ASSERT_EQUAL(connectivity_connected(g->connectivity,x,y),reach[x][1] == reach[y][1]);
+		free_matrix(reach,size);
+	}
+
+	free_graph(g);
+
+	g = generate_random_graph(30,35,2,&r);
+
+	CU_ASSERT_EQUAL(test_connected(g),1);
+	CU_ASSERT_EQUAL(g->edges_number,35);
+	CU_ASSERT_EQUAL(connectivity_components_number(g->connectivity),1);
+
+	free_graph(g);
+}
+
+/* ########################################################## */
+/* ###################### RNG.C TESTS ####################### */
+/* ########################################################## */
+
+void test_rng(void){
+	int i,x;
+	int count[7] = {0,0,0,0,0,0,0};
+	unsigned long long a,b;
+	rng r1,r2,r3,child1,child2;
+
+	init_rng(&r1,2020,0);
+	init_rng(&r2,2020,0);
+	init_rng(&r3,2020,1);
+
+	/* same seed and stream : same numbers, another stream : other numbers */
+	for (i = 0; i < 100; i++){
+		a = rng_next(&r1);
+		b = rng_next(&r2);
+		CU_ASSERT_EQUAL(a,b);
+		CU_ASSERT_NOT_EQUAL(a,rng_next(&r3));
+	}
+
+	for (i = 0; i < 7000; i++){
+		x = rng_uniform(&r1,7);
+		CU_ASSERT(x >= 0 && x < 7);
+		count[x]++;
+	}
+	for (i = 0; i < 7; i++){
+		CU_ASSERT(count[i] > 800 && count[i] < 1200);
+	}
+
+	for (i = 0; i < 100; i++){
+		CU_ASSERT(rng_double(&r1) >= 0. && rng_double(&r1) < 1.);
+	}
+
+	split_rng(&r1,0,&child1);
+	split_rng(&r2,0,&child2);
+	CU_ASSERT_NOT_EQUAL(rng_next(&child1),rng_next(&child2));
+
+	init_rng(&r1,7,0);
+	init_rng(&r2,7,0);
+	split_rng(&r1,3,&child1);
+	split_rng(&r2,3,&child2);
+	CU_ASSERT_EQUAL(rng_next(&child1),rng_next(&child2));
+}
+
+void test_rng_reproducible_graphs(void){
+	int i,j;
+	int size = 60;
+	int density = compute_density_formula(size);
+	int same = 1;
+	rng r1,r2;
+
+	init_rng(&r1,12345,4);
+	init_rng(&r2,12345,4);
+
+	Pgraph g1 = generate_random_graph(size,density,1,&r1);
+	Pgraph g2 = generate_random_graph(size,density,1,&r2);
+
+	for (i = 0; i < size; i++){
+		for (j = 0; j < size; j++){
+			same = same && g1->adjacency_matrix[i][j] == g2->adjacency_matrix[i][j];
+		}
+	}
+	CU_ASSERT_EQUAL(same,1);
+
+	free_graph(g1);
+	free_graph(g2);
+
+	g1 = generate_random_connected_graph(size,density,&r1);
+	g2 = generate_random_connected_graph(size,density,&r2);
+
+	same = 1;
+	for (i = 0; i < size; i++){
+		for (j = 0; j < size; j++){
+			same = same && g1->adjacency_matrix[i][j] == g2->adjacency_matrix[i][j];
+		}
+	}
+	CU_ASSERT_EQUAL(same,1);
+
+	free_graph(g1);
+	free_graph(g2);
+}
+
+void test_edge_sampler(void){
+	int i,j,k;
+	int found;
+	int counts[3] = {0,0,0};
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	/* a triangle */
+	Pgraph g = new_graph(3);
+	add_edge(g,0,1);
+	add_edge(g,1,2);
+	add_edge(g,0,2);
+
+	Pedge_sampler s = new_edge_sampler(g);
+	CU_ASSERT_EQUAL(s->edges_number,3);
+	CU_ASSERT_EQUAL(s->candidates_number,3);
+
+	for (k = 0; k < 3000; k++){
+		CU_ASSERT_EQUAL(edge_sampler_pick(s,&r,&i,&j),1);
+		counts[i+j-1]++;
+	}
+	/* each edge about 1000 times */
+	for (k = 0; k < 3; k++){
+		CU_ASSERT(counts[k] > 800 && counts[k] < 1200);
+	}
+
+	edge_sampler_park(s,0,1);
+	CU_ASSERT_EQUAL(s->candidates_number,2);
+	edge_sampler_remove(s,1,2);
+	CU_ASSERT_EQUAL(s->edges_number,2);
+	CU_ASSERT_EQUAL(s->candidates_number,1);
+	for (k = 0; k < 20; k++){
+		edge_sampler_pick(s,&r,&i,&j);
+		CU_ASSERT(i+j == 2);
+	}
+
+	edge_sampler_remove(s,0,2);
+	CU_ASSERT_EQUAL(edge_sampler_pick(s,&r,&i,&j),0);
+
+	/* adding an edge brings back the parked ones */
+	edge_sampler_add(s,2,1);
+	edge_sampler_add(s,1,2);
+	CU_ASSERT_EQUAL(s->edges_number,2);
+	CU_ASSERT_EQUAL(s->candidates_number,2);
+	found = 0;
+	for (k = 0; k < 100; k++){
+		edge_sampler_pick(s,&r,&i,&j);
+		found = found || i+j == 1;
+	}
+	CU_ASSERT_EQUAL(found,1);
+
+	free_edge_sampler(s);
+	free_graph(g);
+}
+
+void test_graph_io(void){
+	int i,j;
+	int format;
+	int same;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	Pgraph g = generate_random_connected_graph(50,compute_density_formula(50),&r);
+	Pgraph h;
+	Pgraph_file f;
+
+	for (format = EDGE_LIST_FORMAT; format <= BINARY_FORMAT; format++){
+		CU_ASSERT_EQUAL(write_graph_file(g,TEST_GRAPH_FILE,format),1);
+
+		f = open_graph_reader(TEST_GRAPH_FILE);
+		CU_ASSERT_PTR_NOT_NULL_FATAL(f);
+		CU_ASSERT_EQUAL(f->format,format);
+		CU_ASSERT_EQUAL(f->vertices_number,50);
+		CU_ASSERT_EQUAL(f->edges_number,g->edges_number);
+		close_graph_reader(f);
+
+		h = read_graph_file(TEST_GRAPH_FILE);
+		CU_ASSERT_PTR_NOT_NULL_FATAL(h);
+		CU_ASSERT_EQUAL(h->edges_number,g->edges_number);
+		same = 1;
+		for (i = 0; i < 50; i++){
+			for (j = 0; j < 50; j++){
+				same = same && g->adjacency_matrix[i][j] == h->adjacency_matrix[i][j];
+			}
+		}
+		CU_ASSERT_EQUAL(same,1);
+		free_graph(h);
+	}
+
+	free_graph(g);
+	remove(TEST_GRAPH_FILE);
+
+	CU_ASSERT_PTR_NULL(read_graph_file(TEST_GRAPH_FILE));
+}
+
+/* reads back a generated file, m counts the written edges (duplicates included) */
+static Pgraph read_generated_graph(long long m){
+	Pgraph g = read_graph_file(TEST_GRAPH_FILE);
+
+	CU_ASSERT_PTR_NOT_NULL(g);
+	if (g != NULL){
+		CU_ASSERT_EQUAL(g->edges_number,m);
+	}
+	remove(TEST_GRAPH_FILE);
+
+	return g;
+}
+
+static int vertex_degree(Pgraph g, int i){
+	int j;
+	int d = 0;
+
+	for (j = 0; j < g->vertices_number; j++){
+		d += g->adjacency_matrix[i][j];
+	}
+
+	return d;
+}
+
+void test_geometric_graph(void){
+	int i,j;
+	int n = 400;
+	double radius = 0.08;
+	double *x = (double*)malloc(n*sizeof(double));
+	double *y = (double*)malloc(n*sizeof(double));
+	long long m;
+	long long expected = 0;
+	rng r;
+	init_rng(&r,time(NULL),0);
+	rng copy = r;
+
+	Pgraph_file w = open_graph_writer(TEST_GRAPH_FILE,BINARY_FORMAT,n);
+	m = generate_geometric_graph(w,radius,&r);
+	CU_ASSERT_EQUAL(close_graph_writer(w),m);
+
+	/* the same points, compared by brute force */
+	for (i = 0; i < n; i++){
+		x[i] = rng_double(&copy);
+		y[i] = rng_double(&copy);
+	}
+	for (i = 0; i < n; i++){
+		for (j = i+1; j < n; j++){
+			expected += (x[i]-x[j])*(x[i]-x[j]) + (y[i]-y[j])*(y[i]-y[j]) <= radius*radius;
+		}
+	}
+	CU_ASSERT_EQUAL(m,expected);
+
+	Pgraph g = read_generated_graph(m);
+	free_graph(g);
+	free(x);
+	free(y);
+
+	w = open_graph_writer(TEST_GRAPH_FILE,BINARY_FORMAT,n);
+	CU_ASSERT_EQUAL(generate_geometric_graph(w,0,&r),-1);
+	close_graph_writer(w);
+	remove(TEST_GRAPH_FILE);
+}
+
+void test_barabasi_albert_graph(void){
+	int i;
+	int n = 300;
+	int k = 3;
+	int min_degree = n;
+	long long m;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	Pgraph_file w = open_graph_writer(TEST_GRAPH_FILE,EDGE_LIST_FORMAT,n);
+	m = generate_barabasi_albert_graph(w,k,&r);
+	close_graph_writer(w);
+	CU_ASSERT_EQUAL(m,k*(k+1)/2 + (long long)(n-k-1)*k);
+
+	Pgraph g = read_generated_graph(m);
+	for (i = 0; i < n; i++){
+		if (vertex_degree(g,i) < min_degree){
+			min_degree = vertex_degree(g,i);
+		}
+	}
+	CU_ASSERT_EQUAL(min_degree,k);
+	CU_ASSERT_EQUAL(test_connected(g),1);
+	free_graph(g);
+
+	w = open_graph_writer(TEST_GRAPH_FILE,EDGE_LIST_FORMAT,n);
+	CU_ASSERT_EQUAL(generate_barabasi_albert_graph(w,n,&r),-1);
+	close_graph_writer(w);
+	remove(TEST_GRAPH_FILE);
+}
+
+void test_watts_strogatz_graph(void){
+	int n = 200;
+	int k = 6;
+	int ring = 1;
+	int i;
+	long long m;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	Pgraph_file w = open_graph_writer(TEST_GRAPH_FILE,BINARY_FORMAT,n);
+	m = generate_watts_strogatz_graph(w,k,0,&r);
+	close_graph_writer(w);
+	CU_ASSERT_EQUAL(m,n*k/2);
+
+	Pgraph g = read_generated_graph(m);
+	for (i = 0; i < n; i++){
+		ring = ring && vertex_degree(g,i) == k && g->adjacency_matrix[i][(i+k/2) % n];
+	}
+	CU_ASSERT_EQUAL(ring,1);
+	free_graph(g);
+
+	w = open_graph_writer(TEST_GRAPH_FILE,BINARY_FORMAT,n);
+	m = generate_watts_strogatz_graph(w,k,0.3,&r);
+	close_graph_writer(w);
+	CU_ASSERT_EQUAL(m,n*k/2);
+	g = read_generated_graph(m);
 	free_graph(g);
 
-}
\ No newline at end of file
+	w = open_graph_writer(TEST_GRAPH_FILE,BINARY_FORMAT,n);
+	CU_ASSERT_EQUAL(generate_watts_strogatz_graph(w,3,0.3,&r),-1);
+	close_graph_writer(w);
+	remove(TEST_GRAPH_FILE);
+}
+
+void test_grid_graph(void){
+	int i;
+	int rows = 7;
+	int columns = 9;
+	int regular = 1;
+	long long m;
+
+	Pgraph_file w = open_graph_writer(TEST_GRAPH_FILE,EDGE_LIST_FORMAT,rows*columns);
+	m = generate_grid_graph(w,rows,columns,0);
+	close_graph_writer(w);
+	CU_ASSERT_EQUAL(m,rows*(columns-1) + (rows-1)*columns);
+	Pgraph g = read_generated_graph(m);
+	CU_ASSERT_EQUAL(test_connected(g),1);
+	CU_ASSERT_EQUAL(vertex_degree(g,0),2);
+	CU_ASSERT_EQUAL(vertex_degree(g,columns+1),4);
+	free_graph(g);
+
+	w = open_graph_writer(TEST_GRAPH_FILE,EDGE_LIST_FORMAT,rows*columns);
+	m = generate_grid_graph(w,rows,columns,1);
+	close_graph_writer(w);
+	CU_ASSERT_EQUAL(m,2*rows*columns);
+	g = read_generated_graph(m);
+	for (i = 0; i < rows*columns; i++){
+		regular = regular && vertex_degree(g,i) == 4;
+	}
+	CU_ASSERT_EQUAL(regular,1);
+	free_graph(g);
+
+	w = open_graph_writer(TEST_GRAPH_FILE,EDGE_LIST_FORMAT,rows*columns);
+	CU_ASSERT_EQUAL(generate_grid_graph(w,rows,columns+1,0),-1);
+	close_graph_writer(w);
+	remove(TEST_GRAPH_FILE);
+}
+
+void test_random_regular_graph(void){
+	int i;
+	int n = 100;
+	int d;
+	int degrees[4] = {3,4,90,99};
+	int regular;
+	long long m;
+	Pgraph g;
+	Pgraph_file w;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	for (d = 0; d < 4; d++){
+		w = open_graph_writer(TEST_GRAPH_FILE,BINARY_FORMAT,n);
+		m = generate_random_regular_graph(w,degrees[d],&r);
+		close_graph_writer(w);
+		CU_ASSERT_EQUAL(m,n*degrees[d]/2);
+		g = read_generated_graph(m);
+		regular = 1;
+		for (i = 0; i < n; i++){
+			regular = regular && vertex_degree(g,i) == degrees[d];
+		}
+		CU_ASSERT_EQUAL(regular,1);
+		free_graph(g);
+	}
+
+	w = open_graph_writer(TEST_GRAPH_FILE,BINARY_FORMAT,n+1);
+	CU_ASSERT_EQUAL(generate_random_regular_graph(w,3,&r),-1);
+	close_graph_writer(w);
+	remove(TEST_GRAPH_FILE);
+}
+
+void test_planted_graph(void){
+	int i,j,t;
+	int n = 150;
+	int density = compute_density_formula(n);
+	int planted[3] = {0,1,6};
+	int hubs,leaves;
+	long long m;
+	Pgraph g;
+	Pspanning_tree tree;
+	Pgraph_file w;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	for (t = 0; t < 3; t++){
+		w = open_graph_writer(TEST_GRAPH_FILE,BINARY_FORMAT,n);
+		m = generate_planted_graph(w,planted[t],density,&r);
+		close_graph_writer(w);
+		CU_ASSERT_EQUAL(m,density);
+
+		g = read_generated_graph(m);
+		CU_ASSERT_EQUAL(run_dfs(g),n);
+
+		/* the hubs are the vertices with at least 3 pendant neighbours */
+		hubs = 0;
+		for (i = 0; i < n; i++){
+			leaves = 0;
+			for (j = 0; j < n; j++){
+				leaves += g->adjacency_matrix[i][j] && vertex_degree(g,j) == 1;
+			}
+			hubs += leaves >= 3;
+		}
+		CU_ASSERT_EQUAL(hubs,planted[t]);
+
+		/* no spanning tree does better than the optimum */
+		tree = MBVST(g);
+		CU_ASSERT(tree->branch_vertices_number >= planted[t]);
+		free_spanning_tree(tree);
+		free_graph(g);
+	}
+
+	w = open_graph_writer(TEST_GRAPH_FILE,BINARY_FORMAT,n);
+	CU_ASSERT_EQUAL(generate_planted_graph(w,40,density,&r),-1);
+	CU_ASSERT_EQUAL(generate_planted_graph(w,0,n-2,&r),-1);
+	close_graph_writer(w);
+	remove(TEST_GRAPH_FILE);
+}
+
+void test_instance_cache(void){
+	int i,j,k;
+	int same;
+	int sizes[5] = {30,60,30,90,60};
+	int densities[5];
+	unsigned long long seeds[5] = {1,1,2,1,1};
+	char path[INSTANCE_PATH_LENGTH];
+	Pgraph g;
+	Pgraph h;
+
+	for (k = 0; k < 5; k++){
+		densities[k] = compute_density_formula(sizes[k]);
+	}
+
+	CU_ASSERT_NOT_EQUAL(instance_key(30,densities[0],1),instance_key(30,densities[0],2));
+	CU_ASSERT_NOT_EQUAL(instance_key(30,densities[0],1),instance_key(30,densities[0]+1,1));
+
+	/* the last instance is the second one */
+	CU_ASSERT_EQUAL(generate_instances(TEST_CACHE_DIR,sizes,densities,seeds,5,3),4);
+	CU_ASSERT_EQUAL(generate_instances(TEST_CACHE_DIR,sizes,densities,seeds,5,3),0);
+
+	/* one thread per core, at least one */
+	for (k = 0; k < 4; k++){
+		instance_path(TEST_CACHE_DIR,sizes[k],densities[k],seeds[k],path);
+		remove(path);
+	}
+	CU_ASSERT_EQUAL(generate_instances(TEST_CACHE_DIR,sizes,densities,seeds,5,0),4);
+
+	for (k = 0; k < 4; k++){
+		instance_path(TEST_CACHE_DIR,sizes[k],densities[k],seeds[k],path);
+		g = read_graph_file(path);
+		CU_ASSERT_PTR_NOT_NULL_FATAL(g);
+		CU_ASSERT_EQUAL(g->edges_number,densities[k]);
+		CU_ASSERT_EQUAL(run_dfs(g),sizes[k]);
+
+		/* generated again without the cache, the graph is the same */
+		remove(path);
+		h = load_instance(TEST_CACHE_DIR,sizes[k],densities[k],seeds[k]);
+		same = 1;
+		for (i = 0; i < sizes[k]; i++){
+			for (j = 0; j < sizes[k]; j++){
+				same = same && g->adjacency_matrix[i][j] == h->adjacency_matrix[i][j];
+			}
+		}
+		CU_ASSERT_EQUAL(same,1);
+		free_graph(g);
+		free_graph(h);
+		remove(path);
+	}
+
+	CU_ASSERT_PTR_NULL(load_instance(TEST_CACHE_DIR,6,16,1));
+	remove(TEST_CACHE_DIR);
+}
+
+void test_scc(void){
+	int size = 6;
+	/*
+	 * 0 <-> 1 -> 2 <-> 3 -> 4    5
+	 */
+	int m[6][6] = {
+		{0,1,0,0,0,0},
+		{1,0,1,0,0,0},
+		{0,0,0,1,0,0},
+		{0,0,1,0,1,0},
+		{0,0,0,0,0,0},
+		{0,0,0,0,0,0}};
+
+	Pgraph g = new_graph(size);
+	fill_graph(g,m,1);
+	Pscc s = new_scc(g);
+
+	CU_ASSERT_EQUAL(s->components_number,4);
+	CU_ASSERT_EQUAL(scc_strongly_connected(s,0,1),1);
+	CU_ASSERT_EQUAL(scc_strongly_connected(s,2,3),1);
+	CU_ASSERT_EQUAL(scc_strongly_connected(s,1,2),0);
+	CU_ASSERT_EQUAL(s->component_size[scc_component(s,0)],2);
+	CU_ASSERT_EQUAL(s->component_size[scc_component(s,4)],1);
+
+	CU_ASSERT_EQUAL(scc_reachable(s,0,4),1);
+	CU_ASSERT_EQUAL(scc_reachable(s,4,0),0);
+	CU_ASSERT_EQUAL(scc_reachable(s,3,1),0);
+	CU_ASSERT_EQUAL(scc_reachable(s,5,5),1);
+	CU_ASSERT_EQUAL(scc_reachable(s,0,5),0);
+
+	/* {0,1} -> {2,3} -> {4} */
+	Pgraph d = scc_condensation(s);
+	CU_ASSERT_EQUAL(d->vertices_number,4);
+	CU_ASSERT_EQUAL(d->edges_number,2);
+	CU_ASSERT_EQUAL(d->adjacency_matrix[scc_component(s,1)][scc_component(s,2)],1);
+	CU_ASSERT_EQUAL(d->adjacency_matrix[scc_component(s,3)][scc_component(s,4)],1);
+
+	CU_ASSERT_EQUAL(test_connected(g),0);
+	add_edge(g,4,5);
+	add_edge(g,0,4);
+	CU_ASSERT_EQUAL(test_connected(g),1);
+
+	free_graph(d);
+	free_scc(s);
+	free_graph(g);
+}
+
+void test_scc_random(void){
+	int i,j,k,t;
+	int size = 70;
+	int same;
+	Pgraph g;
+	Pgraph closure;
+	Pscc s;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	/* compared with the transitive closure on sparse directed graphs */
+	for (t = 0; t < 10; t++){
+		g = new_graph(size);
+		for (k = 0; k < size + 10*t; k++){
+			i = rng_uniform(&r,size);
+			j = rng_uniform(&r,size);
+			if (i != j){
+				g->adjacency_matrix[i][j] = 1;
+			}
+		}
+
+		closure = copy_graph(g);
+		roy_warshall(closure);
+		s = new_scc(g);
+
+		same = 1;
+		for (i = 0; i < size; i++){
+			for (j = 0; j < size; j++){
+				if (i == j){
+					continue;
+				}
+				same = same && scc_reachable(s,i,j) == closure->adjacency_matrix[i][j];
+				same = same && scc_strongly_connected(s,i,j) == test_x_y_strongly_connected(closure,i,j);
+			}
+		}
+		CU_ASSERT_EQUAL(same,1);
+
+		free_scc(s);
+		free_graph(closure);
+		free_graph(g);
+	}
+}
+
+void test_block_cut_tree(void){
+	int b,k;
+	int size = 7;
+	/*
+	 * 0-1    4-5
+	 * |/     |/
+	 * 2--3---6
+	 */
+	int m[7][7] = {
+		{0,1,1,0,0,0,0},
+		{1,0,1,0,0,0,0},
+		{1,1,0,1,0,0,0},
+		{0,0,1,0,0,0,1},
+		{0,0,0,0,0,1,1},
+		{0,0,0,0,1,0,1},
+		{0,0,0,1,1,1,0}};
+	int edges = 0;
+
+	Pgraph g = new_graph(size);
+	fill_graph(g,m,0);
+	Pblock_cut_tree t = new_block_cut_tree(g);
+
+	/* two triangles and two bridges */
+	CU_ASSERT_EQUAL(t->blocks_number,4);
+	CU_ASSERT_EQUAL(t->articulations_number,3);
+	CU_ASSERT_EQUAL(t->articulation[2],1);
+	CU_ASSERT_EQUAL(t->articulation[3],1);
+	CU_ASSERT_EQUAL(t->articulation[6],1);
+	CU_ASSERT_EQUAL(t->articulation[0],0);
+	for (b = 0; b < t->blocks_number; b++){
+		k = t->edge_start[b+1] - t->edge_start[b];
+		CU_ASSERT(k == 1 || k == 3);
+		CU_ASSERT_EQUAL(t->block_start[b+1] - t->block_start[b],k == 1 ? 2 : 3);
+		edges += k;
+	}
+	CU_ASSERT_EQUAL(edges,g->edges_number);
+
+	/* a path of 7 nodes */
+	Pgraph tree = get_block_cut_tree(t);
+	CU_ASSERT_EQUAL(tree->vertices_number,7);
+	CU_ASSERT_EQUAL(tree->edges_number,6);
+	CU_ASSERT_EQUAL(run_dfs(tree),7);
+
+	free_graph(tree);
+	free_block_cut_tree(t);
+	free_graph(g);
+}
+
+static Pgraph failing_block_solver(Pgraph g){
+	(void)g;
+
+	return NULL;
+}
+
+void test_solve_by_blocks(void){
+	int i,j,k,b;
+	int size = 120;
+	int subset;
+	int *seen;
+	Pgraph g;
+	Pgraph tree;
+	Pblock_cut_tree t;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	for (k = 0; k < 3; k++){
+		g = generate_random_connected_graph(size,compute_density_formula(size),&r);
+
+		/* every edge is in exactly one block */
+		t = new_block_cut_tree(g);
+		seen = (int*)calloc(size*size,sizeof(int));
+		for (b = 0; b < t->blocks_number; b++){
+			for (i = t->edge_start[b]; i < t->edge_start[b+1]; i++){
+				seen[t->block_edges[2*i]*size + t->block_edges[2*i+1]]++;
+				seen[t->block_edges[2*i+1]*size + t->block_edges[2*i]]++;
+			}
+		}
+		subset = 1;
+		for (i = 0; i < size; i++){
+			for (j = 0; j < size; j++){
+				subset = subset && seen[i*size+j] == g->adjacency_matrix[i][j];
+			}
+		}
+		CU_ASSERT_EQUAL(subset,1);
+		free(seen);
+		free_block_cut_tree(t);
+
+		tree = solve_by_blocks(g,MBVST_graph,4);
+		CU_ASSERT_EQUAL(tree->edges_number,size-1);
+		CU_ASSERT_EQUAL(run_dfs(tree),size);
+		subset = 1;
+		for (i = 0; i < size; i++){
+			for (j = 0; j < size; j++){
+				subset = subset && (!tree->adjacency_matrix[i][j] || g->adjacency_matrix[i][j]);
+			}
+		}
+		CU_ASSERT_EQUAL(subset,1);
+		free_graph(tree);
+
+		/* a failing solver falls back to DFS trees, the tree still spans G */
+		tree = solve_by_blocks(g,failing_block_solver,2);
+		CU_ASSERT_EQUAL(tree->edges_number,size-1);
+		CU_ASSERT_EQUAL(run_dfs(tree),size);
+
+		free_graph(tree);
+		free_graph(g);
+	}
+}
+
+void test_sort_graph_file(void){
+	int i,j,k;
+	int n = 300;
+	int sorted = 1;
+	int edges[2*64];
+	int chunks[2] = {777,37};
+	int read,c;
+	long long last = -1;
+	long long key;
+	char path[1024];
+	Pgraph_file f;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	/* random edges with duplicates, loops and both orientations */
+	Pgraph g = new_graph(n);
+	Pgraph_file w = open_graph_writer(TEST_GRAPH_FILE,EDGE_LIST_FORMAT,n);
+	for (k = 0; k < 5000; k++){
+		i = rng_uniform(&r,n);
+		j = rng_uniform(&r,n);
+		write_edge(w,i,j);
+		if (i != j && !g->adjacency_matrix[i][j]){
+			add_edge(g,i,j);
+		}
+	}
+	close_graph_writer(w);
+
+	/* 7 runs merged at once, then 136 runs merged in several passes */
+	for (c = 0; c < 2; c++){
+		CU_ASSERT_EQUAL(sort_graph_file(TEST_GRAPH_FILE,TEST_SORTED_FILE,BINARY_FORMAT,chunks[c]),g->edges_number);
+
+		f = open_graph_reader(TEST_SORTED_FILE);
+		CU_ASSERT_PTR_NOT_NULL_FATAL(f);
+		last = -1;
+		while ((read = read_edges(f,edges,64)) > 0){
+			for (k = 0; k < read; k++){
+				key = ((long long)edges[2*k] << 32) | edges[2*k+1];
+				sorted = sorted && edges[2*k] < edges[2*k+1] && key > last;
+				sorted = sorted && g->adjacency_matrix[edges[2*k]][edges[2*k+1]];
+				last = key;
+			}
+		}
+		CU_ASSERT_EQUAL(sorted,1);
+		close_graph_reader(f);
+
+		/* the runs are removed */
+		snprintf(path,sizeof(path),"%s.run0",TEST_SORTED_FILE);
+		CU_ASSERT_PTR_NULL(fopen(path,"rb"));
+	}
+
+	/* the runs can not be written : an error, not the end of the program */
+	CU_ASSERT_EQUAL(sort_graph_file(TEST_GRAPH_FILE,"missing.tmp/sorted",BINARY_FORMAT,777),-1);
+	CU_ASSERT_EQUAL(sort_graph_file(TEST_GRAPH_FILE,"missing.tmp/sorted",BINARY_FORMAT,37),-1);
+	CU_ASSERT_EQUAL(repair_graph_file(TEST_GRAPH_FILE,"missing.tmp/sorted",BINARY_FORMAT,&r),-1);
+
+	free_graph(g);
+	remove(TEST_GRAPH_FILE);
+	remove(TEST_SORTED_FILE);
+
+	CU_ASSERT_EQUAL(sort_graph_file(TEST_GRAPH_FILE,TEST_SORTED_FILE,BINARY_FORMAT,777),-1);
+}
+
+void test_external_repair(void){
+	int i,j,k;
+	int n = 200;
+	int components_number;
+	int *component;
+	Pscc labels;
+	int same = 1;
+	long long m;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	/* a sparse graph with many components */
+	Pgraph g = new_graph(n);
+	for (k = 0; k < 150; k++){
+		i = rng_uniform(&r,n);
+		j = rng_uniform(&r,n);
+		if (i != j && !g->adjacency_matrix[i][j]){
+			add_edge(g,i,j);
+		}
+	}
+	write_graph_file(g,TEST_GRAPH_FILE,BINARY_FORMAT);
+
+	component = external_components(TEST_GRAPH_FILE,&components_number);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(component);
+	labels = new_scc(g);
+	for (i = 0; i < n; i++){
+		for (j = 0; j < n; j++){
+			same = same && (component[i] == component[j]) == scc_strongly_connected(labels,i,j);
+		}
+	}
+	CU_ASSERT_EQUAL(same,1);
+	CU_ASSERT_EQUAL(components_number,labels->components_number);
+	free(component);
+	free_scc(labels);
+
+	m = repair_graph_file(TEST_GRAPH_FILE,TEST_SORTED_FILE,EDGE_LIST_FORMAT,&r);
+	Pgraph h = read_graph_file(TEST_SORTED_FILE);
+	CU_ASSERT_PTR_NOT_NULL_FATAL(h);
+	CU_ASSERT_EQUAL(h->edges_number,m);
+	CU_ASSERT_EQUAL(run_dfs(h),n);
+
+	component = external_components(TEST_SORTED_FILE,&components_number);
+	CU_ASSERT_EQUAL(components_number,1);
+	free(component);
+	free_graph(h);
+	free_graph(g);
+
+	/* enough edges : the number of edges does not change */
+	g = generate_random_graph(100,200,1,&r);
+	for (k = 0; k < 10; k++){
+		i = rng_uniform(&r,100);
+		for (j = 0; j < 100; j++){
+			if (g->adjacency_matrix[i][j]){
+				remove_edge(g,i,j);
+			}
+		}
+	}
+	write_graph_file(g,TEST_GRAPH_FILE,BINARY_FORMAT);
+	CU_ASSERT_EQUAL(repair_graph_file(TEST_GRAPH_FILE,TEST_SORTED_FILE,BINARY_FORMAT,&r),g->edges_number);
+	h = read_graph_file(TEST_SORTED_FILE);
+	CU_ASSERT_EQUAL(run_dfs(h),100);
+	CU_ASSERT_EQUAL(h->edges_number,g->edges_number);
+
+	free_graph(h);
+	free_graph(g);
+	remove(TEST_GRAPH_FILE);
+	remove(TEST_SORTED_FILE);
+}
+
+void test_graph_fingerprint(void){
+	int i,k;
+	int size = 80;
+	int **edges_list;
+	fingerprint f1,f2,f3;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	edges_list = generate_random_connected_edges_list(size,150,&r);
+
+	/* the same edges added in two orders */
+	Pgraph g1 = new_graph(size);
+	Pgraph g2 = new_graph(size);
+	for (k = 0; k < 150; k++){
+		add_edge(g1,edges_list[k][0],edges_list[k][1]);
+		i = 149-k;
+		add_edge(g2,edges_list[i][1],edges_list[i][0]);
+	}
+
+	f1 = graph_fingerprint(g1);
+	f2 = graph_fingerprint(g2);
+	CU_ASSERT(f1.high == f2.high && f1.low == f2.low);
+
+	remove_edge(g2,edges_list[0][0],edges_list[0][1]);
+	f3 = graph_fingerprint(g2);
+	CU_ASSERT(f1.high != f3.high && f1.low != f3.low);
+
+	/* the same edges on more vertices */
+	Pgraph g3 = new_graph(size+1);
+	for (k = 0; k < 150; k++){
+		add_edge(g3,edges_list[k][0],edges_list[k][1]);
+	}
+	f3 = graph_fingerprint(g3);
+	CU_ASSERT(f1.high != f3.high || f1.low != f3.low);
+
+	free_matrix(edges_list,150);
+	free_graph(g1);
+	free_graph(g2);
+	free_graph(g3);
+}
+
+void test_solve_cache(void){
+	int i,j;
+	int same;
+	char path[SOLVE_PATH_LENGTH];
+	char expected[32];
+	solve_result result;
+	solve_result loaded;
+	solve_result solved;
+	solve_result cached;
+	Pgraph k4,cycle,tree;
+	FILE *file;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	Pgraph g = generate_random_connected_graph(40,compute_density_formula(40),&r);
+
+	CU_ASSERT_EQUAL(load_solve_result(TEST_RESULT_DIR,g,"mbvst","",&loaded),0);
+
+	/* the second solve is read from the cache, with the time of the first */
+	CU_ASSERT_EQUAL(cached_MBVST(TEST_RESULT_DIR,g,&solved),0);
+	CU_ASSERT_EQUAL(cached_MBVST(TEST_RESULT_DIR,g,&cached),1);
+	tree = solved.tree;
+	same = 1;
+	for (i = 0; i < 40; i++){
+		for (j = 0; j < 40; j++){
+			same = same && tree->adjacency_matrix[i][j] == cached.tree->adjacency_matrix[i][j];
+		}
+	}
+	CU_ASSERT_EQUAL(same,1);
+	CU_ASSERT_EQUAL(solved.branch_vertices,get_branch_vertex_number(tree));
+	CU_ASSERT_EQUAL(cached.branch_vertices,solved.branch_vertices);
+	CU_ASSERT_EQUAL(cached.upper_bound,solved.branch_vertices);
+	CU_ASSERT_EQUAL(solved.lower_bound,get_branch_vertex_lower_bound(g));
+	CU_ASSERT_EQUAL(cached.lower_bound,solved.lower_bound);
+	CU_ASSERT_DOUBLE_EQUAL(cached.time,solved.time,1e-3);
+
+	CU_ASSERT_EQUAL(load_solve_result(TEST_RESULT_DIR,g,"mbvst","",&loaded),1);
+	CU_ASSERT_EQUAL(loaded.branch_vertices,get_branch_vertex_number(tree));
+	CU_ASSERT_EQUAL(loaded.upper_bound,loaded.branch_vertices);
+	CU_ASSERT_EQUAL(loaded.tree->edges_number,39);
+	free_graph(loaded.tree);
+
+	/* other parameters, other entry */
+	result.tree = tree;
+	result.branch_vertices = get_branch_vertex_number(tree);
+	result.lower_bound = 0;
+	result.upper_bound = 7;
+	result.time = 1.5;
+	CU_ASSERT_EQUAL(load_solve_result(TEST_RESULT_DIR,g,"mbvst","restarts=4",&loaded),0);
+	CU_ASSERT_EQUAL(store_solve_result(TEST_RESULT_DIR,g,"mbvst","restarts=4",&result),1);
+	CU_ASSERT_EQUAL(load_solve_result(TEST_RESULT_DIR,g,"mbvst","restarts=4",&loaded),1);
+	CU_ASSERT_EQUAL(loaded.branch_vertices,result.branch_vertices);
+	CU_ASSERT_EQUAL(loaded.upper_bound,7);
+	CU_ASSERT_DOUBLE_EQUAL(loaded.time,1.5,1e-6);
+	free_graph(loaded.tree);
+
+	/* the version of the solvers is part of the key */
+	snprintf(expected,sizeof(expected),"-mbvst-v%d-",SOLVE_CACHE_VERSION);
+	solve_result_path(TEST_RESULT_DIR,graph_fingerprint(g),"mbvst","",path);
+	CU_ASSERT_PTR_NOT_NULL(strstr(path,expected));
+
+	/* a wrong number of branch vertices is a miss */
+	result.branch_vertices++;
+	CU_ASSERT_EQUAL(store_solve_result(TEST_RESULT_DIR,g,"mbvst","wrong",&result),1);
+	CU_ASSERT_EQUAL(load_solve_result(TEST_RESULT_DIR,g,"mbvst","wrong",&loaded),0);
+	solve_result_path(TEST_RESULT_DIR,graph_fingerprint(g),"mbvst","wrong",path);
+	remove(path);
+
+	/* n-1 edges of G with a cycle do not span G, it is a miss */
+	k4 = new_graph(5);
+	cycle = new_graph(5);
+	for (i = 0; i < 4; i++){
+		for (j = i+1; j < 4; j++){
+			add_edge(k4,i,j);
+		}
+	}
+	add_edge(k4,3,4);
+	add_edge(cycle,0,1);
+	add_edge(cycle,1,2);
+	add_edge(cycle,0,2);
+	add_edge(cycle,2,3);
+	result.tree = cycle;
+	result.branch_vertices = get_branch_vertex_number(cycle);
+	CU_ASSERT_EQUAL(store_solve_result(TEST_RESULT_DIR,k4,"mbvst","",&result),1);
+	CU_ASSERT_EQUAL(load_solve_result(TEST_RESULT_DIR,k4,"mbvst","",&loaded),0);
+	solve_result_path(TEST_RESULT_DIR,graph_fingerprint(k4),"mbvst","",path);
+	remove(path);
+	free_graph(cycle);
+	free_graph(k4);
+
+	/* a truncated file is a miss */
+	solve_result_path(TEST_RESULT_DIR,graph_fingerprint(g),"mbvst","restarts=4",path);
+	file = fopen(path,"w");
+	fprintf(file,"version %d\nsolver mbvst\nparameters restarts=4\nvertices 40\n",SOLVE_CACHE_VERSION);
+	fclose(file);
+	CU_ASSERT_EQUAL(load_solve_result(TEST_RESULT_DIR,g,"mbvst","restarts=4",&loaded),0);
+	remove(path);
+
+	solve_result_path(TEST_RESULT_DIR,graph_fingerprint(g),"mbvst","",path);
+	remove(path);
+	remove(TEST_RESULT_DIR);
+
+	free_graph(tree);
+	free_graph(cached.tree);
+	free_graph(g);
+}
+
+void test_bridge_set(void){
+	int i,j,k;
+	int size = 6;
+	/*
+	 * 0-1    4
+	 * |/     |
+	 * 2--3   5
+	 */
+	int m[6][6] = {
+		{0,1,1,0,0,0},
+		{1,0,1,0,0,0},
+		{1,1,0,1,0,0},
+		{0,0,1,0,0,0},
+		{0,0,0,0,0,1},
+		{0,0,0,0,1,0}};
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	Pgraph g = new_graph(size);
+	fill_graph(g,m,0);
+	Pbridge_set s = new_bridge_set(g);
+
+	CU_ASSERT_EQUAL(s->components_number,2);
+	CU_ASSERT_EQUAL(bridge_set_is_bridge(s,2,3),1);
+	CU_ASSERT_EQUAL(bridge_set_is_bridge(s,4,5),1);
+	CU_ASSERT_EQUAL(bridge_set_is_bridge(s,0,1),0);
+	CU_ASSERT_EQUAL(bridge_set_is_bridge(s,0,3),0);
+	CU_ASSERT_EQUAL(bridge_set_remove(s,2,3),0);
+
+	/* only the triangle can be drawn */
+	for (k = 0; k < 20; k++){
+		CU_ASSERT_EQUAL(bridge_set_pick(s,&r,&i,&j),1);
+		CU_ASSERT(i < 3 && j < 3);
+	}
+
+	/* a triangle without one edge is a path of bridges */
+	bridge_set_pick(s,&r,&i,&j);
+	CU_ASSERT_EQUAL(bridge_set_remove(s,i,j),1);
+	CU_ASSERT_EQUAL(g->adjacency_matrix[i][j],0);
+	CU_ASSERT_EQUAL(g->edges_number,4);
+	CU_ASSERT_EQUAL(bridge_set_pick(s,&r,&i,&j),0);
+	CU_ASSERT_EQUAL(bridge_set_is_bridge(s,0,1) + bridge_set_is_bridge(s,1,2) + bridge_set_is_bridge(s,0,2),2);
+
+	free_bridge_set(s);
+	free_graph(g);
+}
+
+/* (x,y) is a bridge if x and y are not connected anymore without it */
+static int brute_force_bridge(Pgraph g, int x, int y){
+	int before,after;
+	int **reach;
+
+	reach = connected_components_vertices(g);
+	before = reach[x][1] == reach[y][1];
+	free_matrix(reach,g->vertices_number);
+
+	remove_edge(g,x,y);
+	reach = connected_components_vertices(g);
+	after = reach[x][1] == reach[y][1];
+	free_matrix(reach,g->vertices_number);
+	add_edge(g,x,y);
+
+	return before && !after;
+}
+
+void test_bridge_set_random(void){
+	int i,j,t;
+	int size = 40;
+	int same,forest_removals;
+	int x,y;
+	Pgraph g;
+	Pbridge_set s;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	for (t = 0; t < 5; t++){
+		g = generate_random_connected_graph(size,60+10*t,&r);
+		s = new_bridge_set(g);
+		forest_removals = 0;
+
+		/* remove non bridges until the graph is a tree */
+		while (bridge_set_pick(s,&r,&x,&y)){
+			same = 1;
+			for (i = 0; i < size; i++){
+				for (j = i+1; j < size; j++){
+					if (g->adjacency_matrix[i][j]){
+						same = same && bridge_set_is_bridge(s,i,j) == brute_force_bridge(g,i,j);
+					}
+				}
+			}
+			CU_ASSERT_EQUAL(same,1);
+			forest_removals += s->tree[edge_table_get(s->ids,x,y)];
+			CU_ASSERT_EQUAL(bridge_set_remove(s,x,y),1);
+		}
+
+		CU_ASSERT_EQUAL(g->edges_number,size-1);
+		CU_ASSERT_EQUAL(run_dfs(g),size);
+		/* the decomposition is only computed again after a forest edge */
+		CU_ASSERT(s->decompositions_number <= forest_removals+1);
+
+		free_bridge_set(s);
+		free_graph(g);
+	}
+}
+
+/* ########################################################## */
+/* ################### BGL_GRAPH.C TESTS #################### */
+/* ########################################################## */
+
+void test_bgl_graph(void){
+	int i,v,degree,weight;
+	int n = 80;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	Pgraph g = generate_random_connected_graph(n,compute_density_formula(n),&r);
+	int size = g->edges_number;
+	int **edges_list = get_edges_list(g);
+	int *weight_list = get_weight_list(g);
+	Pbgl_graph b = new_bgl_graph(n,edges_list,size,weight_list);
+	bgl_weight_map weights = get(boost::edge_weight,*b);
+	boost::graph_traits<bgl_graph>::out_edge_iterator e,end;
+	boost::graph_traits<bgl_graph>::vertex_iterator u,last;
+
+	for (i = 0; i < size; i++){
+		weight_list[i] = i;
+	}
+
+	CU_ASSERT_EQUAL(boost::num_vertices(*b),n);
+
+	v = 0;
+	for (boost::tie(u,last) = boost::vertices(*b); u != last; ++u){
+		CU_ASSERT_EQUAL(*u,v);
+		degree = 0;
+		for (boost::tie(e,end) = boost::out_edges(*u,*b); e != end; ++e){
+			CU_ASSERT_EQUAL(boost::source(*e,*b),*u);
+			CU_ASSERT(g->adjacency_matrix[*u][boost::target(*e,*b)]);
+			weight = get(weights,*e);
+			CU_ASSERT(weight == find_edge(edges_list,size,*u,boost::target(*e,*b)));
+			degree++;
+		}
+		CU_ASSERT_EQUAL(degree,get_vertex_degree(g,v));
+		CU_ASSERT_EQUAL(boost::out_degree(*u,*b),degree);
+		v++;
+	}
+
+	free_bgl_graph(b);
+	free(weight_list);
+	free_matrix(edges_list,size);
+	free_graph(g);
+}
+
+/* ########################################################## */
+/* #################### MIN_CUT.C TESTS ##################### */
+/* ########################################################## */
+
+void test_min_cut(void){
+	int i,k,n,size,mask,cut,best,same,small_same;
+	int side[10];
+	int *weight_list;
+	int *cut_list;
+	int *boost_cut_list;
+	int **edges_list;
+	Pgraph g;
+	Pmin_cut_workspace w = new_min_cut_workspace(10,45,0);
+	Pmin_cut_workspace small = new_min_cut_workspace(10,45,8);
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	for (k = 0; k < 300; k++){
+		n = 2 + rng_uniform(&r,9);
+		g = generate_random_connected_graph(n,n-1+rng_uniform(&r,(n-1)*(n-2)/2+1),&r);
+		size = g->edges_number;
+		edges_list = get_edges_list(g);
+		weight_list = get_weight_list(g);
+		/* the weights of MBVST : 1 to 7, and 1000 for the edges of T. One
+		   graph out of four has only heavy edges, its first cut is at least
+		   1000 */
+		for (i = 0; i < size; i++){
+			weight_list[i] = rng_uniform(&r,4) == 0 ? 1000 : 1 + rng_uniform(&r,7);
+			weight_list[i] += k % 4 == 0 ? 1000 : 0;
+		}
+
+		/* every cut is tried */
+		best = -1;
+		for (mask = 1; mask < (1<<n)-1; mask += 2){
+			cut = 0;
+			for (i = 0; i < size; i++){
+				if (((mask>>edges_list[i][0])&1) != ((mask>>edges_list[i][1])&1)){
+					cut += weight_list[i];
+				}
+			}
+			if (best == -1 || cut < best){
+				best = cut;
+			}
+		}
+
+		CU_ASSERT_EQUAL(min_cut(weight_list,n,edges_list,size,side),best);
+		cut = 0;
+		for (i = 0; i < size; i++){
+			cut += side[edges_list[i][0]] != side[edges_list[i][1]] ? weight_list[i] : 0;
+		}
+		CU_ASSERT_EQUAL(cut,best);
+
+		/* the same workspace for every graph */
+		CU_ASSERT_EQUAL(workspace_min_cut(w,weight_list,n,edges_list,size,NULL),best);
+
+		/* the cut is the one found by boost, even among ties */
+		cut_list = run_min_cut(weight_list,n,edges_list,size);
+		boost_cut_list = run_stoer_wagner(weight_list,n,edges_list,size);
+		same = 1;
+		for (i = 0; i < size; i++){
+			same = same && cut_list[i] == boost_cut_list[i];
+		}
+		CU_ASSERT(same);
+
+		/* too few buckets for the weights : the same cut, without allocating */
+		allocations_number = 0;
+		counting_allocations = 1;
+		cut = workspace_min_cut(small,weight_list,n,edges_list,size,side);
+		counting_allocations = 0;
+		CU_ASSERT_EQUAL(allocations_number,0);
+		CU_ASSERT_EQUAL(cut,best);
+		small_same = 1;
+		for (i = 0; i < size; i++){
+			small_same = small_same && (side[edges_list[i][0]] != side[edges_list[i][1]]) == boost_cut_list[i];
+		}
+		CU_ASSERT(small_same);
+		free(cut_list);
+		free(boost_cut_list);
+
+		free(weight_list);
+		free_matrix(edges_list,size);
+		free_graph(g);
+	}
+
+	free_min_cut_workspace(small);
+	free_min_cut_workspace(w);
+}
+
+/* ########################################################## */
+/* ################### INCIDENCE.C TESTS #################### */
+/* ########################################################## */
+
+void test_incidence(void){
+	int i,j,k,e,wrong;
+	int n = 70;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	Pgraph g = generate_random_connected_graph(n,3*n,&r);
+	int size = g->edges_number;
+	int **edges_list = get_edges_list(g);
+	Pincidence in = new_incidence(edges_list,n,size);
+
+	CU_ASSERT_EQUAL(in->start[n],2*size);
+
+	wrong = 0;
+	for (i = 0; i < n; i++){
+		CU_ASSERT_EQUAL(in->start[i+1]-in->start[i],get_vertex_degree(g,i));
+		for (k = in->start[i]; k < in->start[i+1]; k++){
+			e = in->edges[k];
+			wrong += k > in->start[i] && in->edges[k-1] >= e;
+			wrong += !g->adjacency_matrix[i][incidence_other_end(edges_list,e,i)];
+		}
+		for (j = 0; j < n; j++){
+			wrong += incidence_find_edge(in,edges_list,i,j) != find_edge(edges_list,size,i,j);
+		}
+	}
+	CU_ASSERT_EQUAL(wrong,0);
+
+	free_incidence(in);
+	free_matrix(edges_list,size);
+	free_graph(g);
+}
+
+/* ########################################################## */
+/* ################# SPANNING_TREE.C TESTS ################## */
+/* ########################################################## */
+
+void test_spanning_tree(void){
+	int i,u,v,added,wrong;
+	int n = 60;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	Pgraph g = generate_random_connected_graph(n,4*n,&r);
+	Pgraph forest = new_graph(n);
+	Pgraph tree_graph;
+	Pspanning_tree tree = new_spanning_tree(n);
+
+	/* random edges follow the matrix version */
+	for (i = 0; i < 10*n; i++){
+		u = rng_uniform(&r,n);
+		v = rng_uniform(&r,n);
+		if (u == v || !g->adjacency_matrix[u][v]){
+			continue;
+		}
+		CU_ASSERT_EQUAL(spanning_tree_connected(tree,u,v),connected_components_two_vertices(forest,u,v));
+		added = spanning_tree_add_edge(tree,u,v);
+		CU_ASSERT_EQUAL(added,!connected_components_two_vertices(forest,u,v));
+		if (added){
+			add_edge(forest,u,v);
+		}
+	}
+
+	CU_ASSERT_EQUAL(tree->edges_number,forest->edges_number);
+	CU_ASSERT_EQUAL(tree->branch_vertices_number,get_branch_vertex_number(forest));
+	wrong = 0;
+	for (v = 0; v < n; v++){
+		wrong += tree->degree[v] != get_vertex_degree(forest,v);
+	}
+	CU_ASSERT_EQUAL(wrong,0);
+
+	/* back and forth with the graph */
+	tree_graph = spanning_tree_to_graph(tree);
+	free_spanning_tree(tree);
+	tree = graph_to_spanning_tree(tree_graph);
+	CU_ASSERT_EQUAL(tree->edges_number,forest->edges_number);
+	CU_ASSERT_EQUAL(tree->branch_vertices_number,get_branch_vertex_number(forest));
+
+	free_spanning_tree(tree);
+	free_graph(tree_graph);
+	free_graph(forest);
+	free_graph(g);
+}
+
+/* ########################################################## */
+/* ################# MULTI_START.C TESTS #################### */
+/* ########################################################## */
+
+void test_multi_start(void){
+	int k,n,done,lower_bound;
+	Pgraph g;
+	Pspanning_tree tree;
+	Pspanning_tree best;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	for (k = 0; k < 8; k++){
+		n = 10 + rng_uniform(&r,90);
+		g = random_test_graph(n,&r);
+		tree = MBVST(g);
+		best = MBVST_multi_start(g,6,1 + k%4,rng_next(&r),&done);
+		lower_bound = get_branch_vertex_lower_bound(g);
+
+		/* a cover tree of G, never worse than MBVST */
+		CU_ASSERT(is_cover_forest(g,best,1));
+		CU_ASSERT(best->branch_vertices_number <= tree->branch_vertices_number);
+		CU_ASSERT(best->branch_vertices_number >= lower_bound);
+		CU_ASSERT(done >= 1 && done <= 6);
+		CU_ASSERT(done == 6 || best->branch_vertices_number == lower_bound);
+
+		free_spanning_tree(best);
+		free_spanning_tree(tree);
+		free_graph(g);
+	}
+
+	/* a tree reaches the lower bound : the first run stops the others */
+	g = generate_random_connected_graph(60,59,&r);
+	best = MBVST_multi_start(g,10,1,rng_next(&r),&done);
+	CU_ASSERT_EQUAL(best->branch_vertices_number,get_branch_vertex_lower_bound(g));
+	CU_ASSERT_EQUAL(done,1);
+	free_spanning_tree(best);
+	free_graph(g);
+}
+
+/* ########################################################## */
+/* ################ LINK_CUT_TREE.C TESTS ################### */
+/* ########################################################## */
+
+/* the path from u to v in the forest, in path[0..], returns its length */
+static int forest_path(Pgraph forest, int u, int v, int *path){
+	int i,x,head,tail,length;
+	int n = forest->vertices_number;
+	int *previous = (int*) malloc(n*sizeof(int));
+	int *queue = (int*) malloc(n*sizeof(int));
+
+	for (x = 0; x < n; x++){
+		previous[x] = -2;
+	}
+	previous[u] = -1;
+	queue[0] = u;
+	head = 0;
+	tail = 1;
+	while (head < tail){
+		x = queue[head++];
+		for (i = 0; i < n; i++){
+			if (forest->adjacency_matrix[x][i] && previous[i] == -2){
+				previous[i] = x;
+				queue[tail++] = i;
+			}
+		}
+	}
+
+	length = 0;
+	if (previous[v] != -2){
+		for (x = v; x != -1; x = previous[x]){
+			length++;
+		}
+		i = length;
+		for (x = v; x != -1; x = previous[x]){
+			path[--i] = x;
+		}
+	}
+
+	free(previous);
+	free(queue);
+
+	return length;
+}
+
+void test_link_cut_tree(void){
+	int i,k,u,v,length,best,second,wrong;
+	int n = 40;
+	int top[3];
+	int path[40];
+	int value[40];
+	Pgraph forest = new_graph(n);
+	Plink_cut_tree t = new_link_cut_tree(n);
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	for (v = 0; v < n; v++){
+		value[v] = -1;
+	}
+
+	wrong = 0;
+	for (k = 0; k < 3000; k++){
+		u = rng_uniform(&r,n);
+		v = rng_uniform(&r,n);
+		if (u == v){
+			continue;
+		}
+
+		switch (rng_uniform(&r,4)){
+			case 0:
+				/* link or cut */
+				if (forest->adjacency_matrix[u][v]){
+					wrong += link_cut_tree_cut(t,u,v) != 1;
+					remove_edge(forest,u,v);
+				}
+				else if (!forest_path(forest,u,v,path)){
+					link_cut_tree_link(t,u,v);
+					add_edge(forest,u,v);
+				}
+				else{
+					wrong += link_cut_tree_cut(t,u,v) != 0;
+				}
+				break;
+			case 1:
+				value[u] = rng_uniform(&r,6) - 1;
+				link_cut_tree_set_value(t,u,value[u]);
+				break;
+			default:
+				/* the path, its nodes and its two largest values */
+				length = forest_path(forest,u,v,path);
+				wrong += link_cut_tree_connected(t,u,v) != (length > 0);
+				if (length == 0){
+					break;
+				}
+				wrong += link_cut_tree_path_top(t,u,v,top) != length;
+				for (i = 0; i < length; i++){
+					wrong += link_cut_tree_path_node(t,u,v,i) != path[i];
+				}
+				best = -1;
+				second = -1;
+				for (i = 0; i < length; i++){
+					if (value[path[i]] > best){
+						second = best;
+						best = value[path[i]];
+					}
+					else if (value[path[i]] > second){
+						second = value[path[i]];
+					}
+				}
+				wrong += (top[0] == -1 ? -1 : value[top[0]]) != best;
+				wrong += (top[1] == -1 ? -1 : value[top[1]]) != second;
+				break;
+		}
+	}
+	CU_ASSERT_EQUAL(wrong,0);
+
+	free_link_cut_tree(t);
+	free_graph(forest);
+}
+
+/* ########################################################## */
+/* ################ LOCAL_SEARCH.C TESTS #################### */
+/* ########################################################## */
+
+/* the branch vertices first, then the degrees over 2 */
+static int swap_objective(Pgraph tree){
+	int v,d;
+	int n = tree->vertices_number;
+	int res = 0;
+
+	for (v = 0; v < n; v++){
+		d = get_vertex_degree(tree,v);
+		res += d > 2 ? 2*n+1 + d-2 : 0;
+	}
+
+	return res;
+}
+
+void test_local_search(void){
+	int i,k,n,a,b,length,objective,improving,moves;
+	int path[60];
+	Pgraph g;
+	Pgraph tree_graph;
+	Pspanning_tree tree;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	for (k = 0; k < 10; k++){
+		n = 10 + rng_uniform(&r,50);
+		g = random_test_graph(n,&r);
+		tree = k % 2 ? MBVST_fast(g) : MBVST(g);
+		tree_graph = spanning_tree_to_graph(tree);
+		objective = swap_objective(tree_graph);
+		free_graph(tree_graph);
+
+		moves = local_search(g,tree,0);
+
+		/* a cover tree of G, better by at least one per move */
+		CU_ASSERT(is_cover_forest(g,tree,1));
+		tree_graph = spanning_tree_to_graph(tree);
+		CU_ASSERT(swap_objective(tree_graph) <= objective - moves);
+		objective = swap_objective(tree_graph);
+
+		/* a local optimum : no swap is better */
+		improving = 0;
+		for (a = 0; a < n; a++){
+			for (b = a+1; b < n; b++){
+				if (!g->adjacency_matrix[a][b] || tree_graph->adjacency_matrix[a][b]){
+					continue;
+				}
+				length = forest_path(tree_graph,a,b,path);
+				add_edge(tree_graph,a,b);
+				for (i = 0; i+1 < length; i++){
+					remove_edge(tree_graph,path[i],path[i+1]);
+					improving += swap_objective(tree_graph) < objective;
+					add_edge(tree_graph,path[i],path[i+1]);
+				}
+				remove_edge(tree_graph,a,b);
+			}
+		}
+		CU_ASSERT_EQUAL(improving,0);
+
+		free_graph(tree_graph);
+		free_spanning_tree(tree);
+		free_graph(g);
+	}
+}
+
+/* ########################################################## */
+/* ################### ANYTIME.C TESTS ###################### */
+/* ########################################################## */
+
+static void budget_solve(Pgraph g, double deadline, Pbudget_result result){
+	MBVST_with_budget(g,deadline,result);
+}
+
+void test_MBVST_with_budget(void){
+	int n,branch_vertices,last,reads,wrong;
+	Pgraph g;
+	Pgraph tree_graph;
+	Pspanning_tree tree;
+	budget_result result;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	n = 150;
+	g = generate_random_connected_graph(n,compute_density_formula(n),&r);
+	init_budget_result(&result,rng_next(&r));
+
+	/* the best tree is read while the solver runs */
+	boost::thread solver(budget_solve,g,0.3,&result);
+	reads = 0;
+	wrong = 0;
+	last = -1;
+	while (!solver.timed_join(boost::posix_time::milliseconds(5))){
+		tree = budget_result_best(&result,&branch_vertices);
+		if (tree == NULL){
+			continue;
+		}
+		reads++;
+		tree_graph = spanning_tree_to_graph(tree);
+		wrong += run_dfs(tree_graph) != n;
+		wrong += tree->branch_vertices_number != branch_vertices;
+		wrong += last != -1 && branch_vertices > last;
+		last = branch_vertices;
+		free_graph(tree_graph);
+		free_spanning_tree(tree);
+	}
+	CU_ASSERT_EQUAL(wrong,0);
+	CU_ASSERT(reads > 0);
+
+	/* a cover tree of G, as good as MBVST and the local search */
+	CU_ASSERT(result.tree != NULL);
+	CU_ASSERT(result.trees >= 2 || result.branch_vertices == result.lower_bound);
+	CU_ASSERT(result.time <= 0.3 + 0.5);
+	CU_ASSERT(is_cover_forest(g,result.tree,1));
+	CU_ASSERT(result.branch_vertices >= result.lower_bound);
+	tree = MBVST_local_search(g,0);
+	CU_ASSERT(result.trees < 2 || result.branch_vertices <= tree->branch_vertices_number);
+	free_spanning_tree(tree);
+	free_spanning_tree(result.tree);
+
+	/* a spent budget still gives a tree */
+	init_budget_result(&result,0);
+	CU_ASSERT(MBVST_with_budget(g,0,&result) >= result.lower_bound);
+	CU_ASSERT_EQUAL(result.trees,1);
+	CU_ASSERT_EQUAL(result.tree->edges_number,n-1);
+	free_spanning_tree(result.tree);
+
+	free_graph(g);
+}
+
+/* ########################################################## */
+/* ################ CONSTRUCTIVE.C TESTS #################### */
+/* ########################################################## */
+
+void test_constructive(void){
+	int i,k,n,wrong,bad_path;
+	Pgraph g;
+	Pgraph h;
+	Pspanning_tree tree;
+	Pspanning_tree (*builders[3])(Pgraph) = {DFS_tree, greedy_degree_tree, hamiltonian_path_tree};
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	/* a path is its own cover tree, whatever the order of its vertices */
+	n = 30;
+	g = new_graph(n);
+	for (i = 0; i+1 < n; i++){
+		add_edge(g,(7*i)%n,(7*(i+1))%n);
+	}
+	bad_path = 0;
+	for (k = 0; k < 3; k++){
+		tree = builders[k](g);
+		bad_path += !is_cover_forest(g,tree,1) || tree->branch_vertices_number != 0;
+		free_spanning_tree(tree);
+	}
+	CU_ASSERT_EQUAL(bad_path,0);
+	free_graph(g);
+
+	/* sparse and dense random graphs */
+	wrong = 0;
+	for (i = 0; i < 12; i++){
+		n = 10 + rng_uniform(&r,150);
+		g = i%2 ? generate_random_connected_graph(n,3*n,&r) : random_test_graph(n,&r);
+		for (k = 0; k < 3; k++){
+			tree = builders[k](g);
+			wrong += !is_cover_forest(g,tree,1);
+			free_spanning_tree(tree);
+		}
+		free_graph(g);
+	}
+	CU_ASSERT_EQUAL(wrong,0);
+
+	/* two connected components give two trees */
+	n = 40;
+	h = generate_random_connected_graph(n/2,n,&r);
+	g = new_graph(n);
+	for (i = 0; i < n/2; i++){
+		for (k = i+1; k < n/2; k++){
+			if (h->adjacency_matrix[i][k]){
+				add_edge(g,i,k);
+				add_edge(g,n/2+i,n/2+k);
+			}
+		}
+	}
+	wrong = 0;
+	for (k = 0; k < 3; k++){
+		tree = builders[k](g);
+		wrong += !is_cover_forest(g,tree,2);
+		free_spanning_tree(tree);
+	}
+	CU_ASSERT_EQUAL(wrong,0);
+	free_graph(h);
+	free_graph(g);
+}
+
+/* ########################################################## */
+/* ################### ENGINE.C TESTS ####################### */
+/* ########################################################## */
+
+void test_engine(void){
+	int i,k,n,wrong;
+	Pgraph graphs[3];
+	Pspanning_tree tree;
+	const char *names[3] = {"dfs","inconnu","greedy"};
+	FILE *out;
+	rng r;
+	init_rng(&r,time(NULL),0);
+
+	/* the names of the registry */
+	CU_ASSERT(engines_number() >= 6);
+	for (k = 0; k < engines_number(); k++){
+		CU_ASSERT_PTR_NOT_NULL(get_engine(engine_name(k)));
+	}
+	CU_ASSERT_PTR_NULL(engine_name(engines_number()));
+	CU_ASSERT_PTR_NULL(get_engine("inconnu"));
+	CU_ASSERT(get_engine("mbvst") == MBVST);
+	CU_ASSERT(get_engine("hamiltonian") == hamiltonian_path_tree);
+
+	/* every engine gives a cover tree */
+	for (i = 0; i < 3; i++){
+		n = 20 + rng_uniform(&r,60);
+		graphs[i] = random_test_graph(n,&r);
+	}
+	wrong = 0;
+	for (k = 0; k < engines_number(); k++){
+		for (i = 0; i < 3; i++){
+			tree = get_engine(engine_name(k))(graphs[i]);
+			wrong += !is_cover_forest(graphs[i],tree,1);
+			free_spanning_tree(tree);
+		}
+	}
+	CU_ASSERT_EQUAL(wrong,0);
+
+	/* the benchmark skips the unknown names */
+	out = tmpfile();
+	CU_ASSERT_EQUAL(benchmark_engines(out,graphs,3,names,3),2);
+	CU_ASSERT(ftell(out) > 0);
+	fclose(out);
+
+	for (i = 0; i < 3; i++){
+		free_graph(graphs[i]);
+	}
+}
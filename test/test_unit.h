@@ -78,10 +78,18 @@ void test_if_connected(void);
 
 void test_random_graph(void);
 
+void test_repair_connectivity(void);
+
+void test_random_connected_graph(void);
+
+void test_remove_random_edges(void);
+
 void test_number_connected_components(void);
 
 void test_get_vertex_type(void);
 
+void test_get_vertices_type_list(void);
+
 void test_vertices_type_list(void);
 
 void test_connected_components_vertices(void);
@@ -104,4 +112,166 @@ void test_departager(void);
 
 void test_changer_type(void);
 
+void test_MBVST_fast(void);
+
+void test_mbvst_workspace(void);
+
+void test_mbvst_edge_sequence(void);
+
+/* ########################################################## */
+/* ################# EDGE_TABLE.C TESTS ##################### */
+/* ########################################################## */
+
+void test_edge_table(void);
+
+/* ########################################################## */
+/* ############ DYNAMIC_CONNECTIVITY.C TESTS ################ */
+/* ########################################################## */
+
+void test_dynamic_connectivity(void);
+
+void test_dynamic_connectivity_random(void);
+
+/* ########################################################## */
+/* ###################### RNG.C TESTS ####################### */
+/* ########################################################## */
+
+void test_rng(void);
+
+void test_rng_reproducible_graphs(void);
+
+/* ########################################################## */
+/* ################ EDGE_SAMPLER.C TESTS #################### */
+/* ########################################################## */
+
+void test_edge_sampler(void);
+
+/* ########################################################## */
+/* #################### GRAPH_IO.C TESTS #################### */
+/* ########################################################## */
+
+void test_graph_io(void);
+
+/* ########################################################## */
+/* ############# INSTANCE_GENERATOR.C TESTS ################# */
+/* ########################################################## */
+
+void test_geometric_graph(void);
+
+void test_barabasi_albert_graph(void);
+
+void test_watts_strogatz_graph(void);
+
+void test_grid_graph(void);
+
+void test_random_regular_graph(void);
+
+void test_planted_graph(void);
+
+/* ########################################################## */
+/* ############### INSTANCE_CACHE.C TESTS ################### */
+/* ########################################################## */
+
+void test_instance_cache(void);
+
+/* ########################################################## */
+/* ###################### SCC.C TESTS ####################### */
+/* ########################################################## */
+
+void test_scc(void);
+
+void test_scc_random(void);
+
+/* ########################################################## */
+/* ############ BLOCK_DECOMPOSITION.C TESTS ################# */
+/* ########################################################## */
+
+void test_block_cut_tree(void);
+
+void test_solve_by_blocks(void);
+
+/* ########################################################## */
+/* ############### EXTERNAL_GRAPH.C TESTS ################### */
+/* ########################################################## */
+
+void test_sort_graph_file(void);
+
+void test_external_repair(void);
+
+/* ########################################################## */
+/* ################ SOLVE_CACHE.C TESTS ##################### */
+/* ########################################################## */
+
+void test_graph_fingerprint(void);
+
+void test_solve_cache(void);
+
+/* ########################################################## */
+/* ################### BRIDGES.C TESTS ###################### */
+/* ########################################################## */
+
+void test_bridge_set(void);
+
+void test_bridge_set_random(void);
+
+/* ########################################################## */
+/* ################### BGL_GRAPH.C TESTS #################### */
+/* ########################################################## */
+
+void test_bgl_graph(void);
+
+/* ########################################################## */
+/* #################### MIN_CUT.C TESTS ##################### */
+/* ########################################################## */
+
+void test_min_cut(void);
+
+/* ########################################################## */
+/* ################### INCIDENCE.C TESTS #################### */
+/* ########################################################## */
+
+void test_incidence(void);
+
+/* ########################################################## */
+/* ################# SPANNING_TREE.C TESTS ################## */
+/* ########################################################## */
+
+void test_spanning_tree(void);
+
+/* ########################################################## */
+/* ################# MULTI_START.C TESTS #################### */
+/* ########################################################## */
+
+void test_multi_start(void);
+
+/* ########################################################## */
+/* ################ LINK_CUT_TREE.C TESTS ################### */
+/* ########################################################## */
+
+void test_link_cut_tree(void);
+
+/* ########################################################## */
+/* ################ LOCAL_SEARCH.C TESTS #################### */
+/* ########################################################## */
+
+void test_local_search(void);
+
+/* ########################################################## */
+/* ################### ANYTIME.C TESTS ###################### */
+/* ########################################################## */
+
+void test_MBVST_with_budget(void);
+
+/* ########################################################## */
+/* ################ CONSTRUCTIVE.C TESTS #################### */
+/* ########################################################## */
+
+void test_constructive(void);
+
+/* ########################################################## */
+/* ################### ENGINE.C TESTS ####################### */
+/* ########################################################## */
+
+void test_engine(void);
+
 #endif
\ No newline at end of file